@@ -4,14 +4,35 @@ layout(origin_upper_left) in vec4 gl_FragCoord;
 
 out vec3 colour;
 
-uniform sampler2D fontTex;
-uniform sampler2D foreTex;
-uniform sampler2D backTex;
-uniform sampler2D asciiTex;
+uniform usampler2DArray fontTex;    // Glyph row masks: texel (y, g, font) is row y of glyph g, bit x set if lit
+uniform usampler2D glyphTex;        // Glyph cache: texel (y, slot) is row y of a glyph drawn to fit its font
+uniform usampler2DArray glyphMap;   // Glyph of each codepoint c in each font: texel (c & 255, c >> 8, font)
+uniform usampler2D cellTex;
+uniform sampler1D paletteTex;       // Colour of each palette index (see PALETTE_SIZE in game.h)
 
 uniform vec2 uFontRes;
+uniform int uFont;              // Layer of fontTex and glyphMap for cells using the grid's font
 uniform vec2 uResolution;
 
+uniform ivec2 uViewOrigin;      // Canvas coords of the top-left cell on screen
+
+uniform ivec2 uCursorPos;       // Canvas coords of the cell under the cursor
+uniform int uCursorStyle;       // CURSOR_xxx in game.h
+uniform uvec2 uCursorColours;   // Palette indices: x = cursor colour, y = glyph colour under a block cursor
+
+// Cell attribute bits (see CELL_ATTR_xxx in game.h)
+const uint kAttrInverse = 1u;
+const uint kAttrUnderline = 2u;
+
+// Map entries up to this are font glyphs, above it glyph cache slots (see GLYPH_MAP_FONT_GLYPHS in glyphcache.h)
+const uint kFontGlyphs = 256u;
+
+// Cursor styles (see CURSOR_xxx in game.h)
+const int kCursorBlock = 1;
+const int kCursorUnderline = 2;
+const int kCursorBar = 3;
+const int kCursorThickness = 2;
+
 void calcCoords(in vec2 fxy, out int x, out int y, out int cx, out int cy)
 {
     cx = int(fxy.x) / int(uFontRes.x);
@@ -20,11 +41,6 @@ void calcCoords(in vec2 fxy, out int x, out int y, out int cx, out int cy)
     y = int(fxy.y) % int(uFontRes.y);
 }
 
-vec2 calcTextureCoords(in int x, in int y, in int w, in int h)
-{
-    return (vec2(float(x), float(y)) + vec2(0.5, 0.5)) / vec2(float(w), float(h));
-}
-
 void main()
 {
     int x, y, cx, cy;
@@ -32,30 +48,57 @@ void main()
     // (cx, cy) is the character coords, (x, y) is the internal coords in the character space.
     calcCoords(gl_FragCoord.xy, x, y, cx, cy);
 
-    // Calculate p which is the tex coords into the fore, back and ascii textures.
-    vec2 screenChars = uResolution / uFontRes;
-    vec2 p = calcTextureCoords(cx, cy, int(screenChars.x), int(screenChars.y));
-
-    // Look up the textures and obtain the RGBA info
-    vec4 fore = texture(foreTex, p);
-    vec4 back = texture(backTex, p);
-    vec4 text = texture(asciiTex, p);
-
-    int c = int(text.x * 255.0);
+    // Pixels past the last whole cell are left black.
+    ivec2 viewSize = textureSize(cellTex, 0);
+    if (cx >= viewSize.x || cy >= viewSize.y)
+    {
+        colour = vec3(0.0);
+        return;
+    }
 
-    // (fx, fy) is the character coords in the font texture
-    int fx = c % 16;
-    int fy = c / 16;
+    // Fetch the cell: x = codepoint, y = fore | back << 8 | attributes << 16 | font << 24.  The cell texture is a
+    // wrap-around cache of the viewport, holding canvas cell (x, y) at (x % width, y % height).
+    ivec2 canvasPos = ivec2(cx, cy) + uViewOrigin;
+    uvec2 cell = texelFetch(cellTex, canvasPos % viewSize, 0).xy;
+    uint attr = (cell.y >> 16) & 0xffu;
+    vec4 fore = texelFetch(paletteTex, int(cell.y & 0xffu), 0);
+    vec4 back = texelFetch(paletteTex, int((cell.y >> 8) & 0xffu), 0);
+
+    // A block cursor recolours its cell.
+    bool atCursor = canvasPos == uCursorPos;
+    if (atCursor && uCursorStyle == kCursorBlock)
+    {
+        fore = texelFetch(paletteTex, int(uCursorColours.y), 0);
+        back = texelFetch(paletteTex, int(uCursorColours.x), 0);
+    }
 
-    // (lx, ly) is the pixel coords in the font texture
-    int lx = fx * int(uFontRes.x) + x;
-    int ly = fy * int(uFontRes.y) + y;
+    if ((attr & kAttrInverse) != 0u)
+    {
+        vec4 t = fore;
+        fore = back;
+        back = t;
+    }
 
-    // Calculate the texture coords in the font texture.  We expect the font texture to be 16*16 characters.
-    vec2 pixXY = calcTextureCoords(lx, ly, int(uFontRes.x) * 16, int(uFontRes.y) * 16);
-    vec4 charPixel = texture(fontTex, pixXY);
+    // The map says where the codepoint's glyph is in the cell's font (CELL_FONT_GRID in game.h): 0 for blank, the
+    // glyph + 1 in the font's layer, or the glyph cache slot + kFontGlyphs.  One 32-bit texel holds a whole row of the
+    // glyph, and the rows below a shorter font's glyphs are blank.
+    uint font = cell.y >> 24;
+    int layer = font == 0u ? uFont : int(font) - 1;
+    uint glyph = cell.x < 65536u && layer < textureSize(glyphMap, 0).z ?
+        texelFetch(glyphMap, ivec3(cell.x & 255u, cell.x >> 8, layer), 0).r : 0u;
+    uint row = 0u;
+    if (glyph > kFontGlyphs)
+    {
+        row = texelFetch(glyphTex, ivec2(y, glyph - kFontGlyphs), 0).r;
+    }
+    else if (glyph > 0u)
+    {
+        row = texelFetch(fontTex, ivec3(y, glyph - 1u, layer), 0).r;
+    }
+    bool lit = ((row >> uint(x)) & 1u) != 0u;
+    bool underline = ((attr & kAttrUnderline) != 0u) && (y == int(uFontRes.y) - 1);
 
-    if (charPixel.r < 0.5)
+    if (!lit && !underline)
     {
         colour = back.rgb;
     }
@@ -63,5 +106,11 @@ void main()
     {
         colour = fore.rgb;
     }
-}
 
+    // Underline and bar cursors are drawn over the cell.
+    if (atCursor && ((uCursorStyle == kCursorUnderline && y >= int(uFontRes.y) - kCursorThickness) ||
+                     (uCursorStyle == kCursorBar && x < kCursorThickness)))
+    {
+        colour = texelFetch(paletteTex, int(uCursorColours.x), 0).rgb;
+    }
+}
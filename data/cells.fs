@@ -0,0 +1,53 @@
+#version 400
+
+out vec3 colour;
+
+uniform usampler2DArray fontTex;    // Glyph row masks: texel (y, g, font) is row y of glyph g, bit x set if lit
+uniform usampler2D glyphTex;        // Glyph cache: texel (y, slot) is row y of a glyph drawn to fit its font
+
+uniform vec2 uFontRes;
+
+// Cell attribute bits (see CELL_ATTR_xxx in game.h)
+const uint kAttrUnderline = 2u;
+
+// Map entries up to this are font glyphs, above it glyph cache slots (see GLYPH_MAP_FONT_GLYPHS in glyphcache.h)
+const uint kFontGlyphs = 256u;
+
+// Cursor styles (see CURSOR_xxx in game.h)
+const int kCursorUnderline = 2;
+const int kCursorBar = 3;
+const int kCursorThickness = 2;
+
+flat in vec3 fore;
+flat in vec3 back;
+flat in uint glyph;
+flat in int layer;
+flat in uint attr;
+flat in int cursorStyle;
+flat in vec3 cursorColour;
+in vec2 local;
+
+void main()
+{
+    ivec2 p = ivec2(local);
+
+    uint row = 0u;
+    if (glyph > kFontGlyphs)
+    {
+        row = texelFetch(glyphTex, ivec2(p.y, glyph - kFontGlyphs), 0).r;
+    }
+    else if (glyph > 0u)
+    {
+        row = texelFetch(fontTex, ivec3(p.y, glyph - 1u, layer), 0).r;
+    }
+    bool lit = ((row >> uint(p.x)) & 1u) != 0u;
+    bool underline = ((attr & kAttrUnderline) != 0u) && (p.y == int(uFontRes.y) - 1);
+
+    colour = (lit || underline) ? fore : back;
+
+    if ((cursorStyle == kCursorUnderline && p.y >= int(uFontRes.y) - kCursorThickness) ||
+        (cursorStyle == kCursorBar && p.x < kCursorThickness))
+    {
+        colour = cursorColour;
+    }
+}
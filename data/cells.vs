@@ -0,0 +1,81 @@
+#version 400
+
+// Instanced cell renderer: one quad per cell.  The cell is fetched once per instance here, so the fragment shader only
+// has to look up the glyph pixel.
+
+layout(location = 0) in vec2 v;		// Quad corner in [-1, +1]
+
+uniform usampler2D cellTex;
+uniform usampler2DArray glyphMap;   // Glyph of each codepoint c in each font: texel (c & 255, c >> 8, font)
+uniform sampler1D paletteTex;       // Colour of each palette index (see PALETTE_SIZE in game.h)
+
+uniform vec2 uFontRes;
+uniform int uFont;              // Layer of the font texture and glyphMap for cells using the grid's font
+uniform vec2 uResolution;
+uniform int uColumns;
+
+uniform ivec2 uViewOrigin;      // Canvas coords of the top-left cell on screen
+
+uniform ivec2 uCursorPos;       // Canvas coords of the cell under the cursor
+uniform int uCursorStyle;       // CURSOR_xxx in game.h
+uniform uvec2 uCursorColours;   // Palette indices: x = cursor colour, y = glyph colour under a block cursor
+
+// Cell attribute bits (see CELL_ATTR_xxx in game.h)
+const uint kAttrInverse = 1u;
+
+// Cursor styles (see CURSOR_xxx in game.h)
+const int kCursorNone = 0;
+const int kCursorBlock = 1;
+
+flat out vec3 fore;
+flat out vec3 back;
+flat out uint glyph;            // Map entry of the glyph: 0 = blank (see ascii.fs)
+flat out int layer;             // Layer of the font texture: the cell's own font or the grid's
+flat out uint attr;
+flat out int cursorStyle;       // Cursor drawn over this cell (underline and bar only)
+flat out vec3 cursorColour;
+out vec2 local;                 // Pixel coords inside the cell
+
+void main()
+{
+    int cx = gl_InstanceID % uColumns;
+    int cy = gl_InstanceID / uColumns;
+
+    // Per-instance data: x = codepoint, y = fore | back << 8 | attributes << 16 | font << 24.  The cell texture is a
+    // wrap-around cache of the viewport, holding canvas cell (x, y) at (x % width, y % height).
+    ivec2 canvasPos = ivec2(cx, cy) + uViewOrigin;
+    uvec2 cell = texelFetch(cellTex, canvasPos % textureSize(cellTex, 0), 0).xy;
+    attr = (cell.y >> 16) & 0xffu;
+    fore = texelFetch(paletteTex, int(cell.y & 0xffu), 0).rgb;
+    back = texelFetch(paletteTex, int((cell.y >> 8) & 0xffu), 0).rgb;
+
+    // A block cursor recolours its cell; the fragment shader draws the other styles over it.
+    cursorStyle = canvasPos == uCursorPos ? uCursorStyle : kCursorNone;
+    cursorColour = texelFetch(paletteTex, int(uCursorColours.x), 0).rgb;
+    if (cursorStyle == kCursorBlock)
+    {
+        fore = texelFetch(paletteTex, int(uCursorColours.y), 0).rgb;
+        back = cursorColour;
+        cursorStyle = kCursorNone;
+    }
+
+    if ((attr & kAttrInverse) != 0u)
+    {
+        vec3 t = fore;
+        fore = back;
+        back = t;
+    }
+
+    // Look the glyph up in the map once per cell (see ascii.fs).
+    uint font = cell.y >> 24;
+    layer = font == 0u ? uFont : int(font) - 1;
+    glyph = cell.x < 65536u && layer < textureSize(glyphMap, 0).z ?
+        texelFetch(glyphMap, ivec3(cell.x & 255u, cell.x >> 8, layer), 0).r : 0u;
+
+    // Position the quad over the cell, with y going down the screen.
+    vec2 corner = v * 0.5 + 0.5;
+    local = corner * uFontRes;
+    vec2 pixel = (vec2(cx, cy) + corner) * uFontRes;
+    vec2 ndc = pixel / uResolution * 2.0 - 1.0;
+    gl_Position = vec4(ndc.x, -ndc.y, 0.0, 1.0);
+}
@@ -0,0 +1,3 @@
+@echo off
+rem Convert the PNG font atlases in data into precompiled .fnt files (run build.bat first).
+for %%f in (data\font*.png) do _bin\Win64_Release_fontconv\fontconv.exe %%f data\%%~nf.fnt
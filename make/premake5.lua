@@ -6,12 +6,22 @@ filter { "platforms:Win64" }
 	system "Windows"
 	architecture "x64"
 
+filter { "platforms:Linux64" }
+	system "Linux"
+	architecture "x64"
+
+
+-- Files in data that are compiled into the executable by tools/embed.c
+embeddedAssets = {
+    "ascii.vs", "ascii.fs", "cells.vs", "cells.fs",
+    "font1.fnt", "font2.fnt", "font3.fnt", "font4.fnt", "font5.fnt",
+}
 
 -- Solution
 solution "ascii"
 	language "C"
 	configurations { "Debug", "Release" }
-	platforms { "Win64" }
+	platforms { "Win64", "Linux64" }
 	location "../_build"
     debugdir "../data"
     characterset "MBCS"
@@ -42,6 +52,7 @@ solution "ascii"
 		targetdir "../_bin/%{cfg.platform}_%{cfg.buildcfg}_%{prj.name}"
 		objdir "../_obj/%{cfg.platform}_%{cfg.buildcfg}_%{prj.name}"
         kind "WindowedApp"
+        dependson { "embed" }
 		files {
             "../src/**.c",
             "../src/**.h",
@@ -56,7 +67,6 @@ solution "ascii"
 
         -- Libraries to link to (libraries only have release versions)
         links {
-            "opengl32.lib"
         }
 
         -- Defines to make
@@ -77,6 +87,16 @@ solution "ascii"
             links {
             }
 
+        -- Compile the shaders and precompiled fonts into the executable (src/embedded.c is only rewritten when they
+        -- change).  Run with -data <dir> to load them from disk instead.
+        prebuildcommands {
+            '"' .. path.translate(path.join(rootdir, "_bin", "%{cfg.platform}_%{cfg.buildcfg}_embed", "embed")) .. '" ' ..
+                '"' .. path.translate(path.join(rootdir, "src", "embedded.c")) .. '" ' ..
+                table.concat(table.translate(embeddedAssets, function(f)
+                    return '"' .. path.translate(path.join(rootdir, "data", f)) .. '"'
+                end), " ")
+        }
+
         -- Uncomment this to copy contents of data directory next to the exe.
         -- Shouldn't need this since we can set the debug directory to the data directory.
         --
@@ -85,6 +105,14 @@ solution "ascii"
         --         path.translate(path.join(rootdir, "_Bin", "%{cfg.platform}", "%{cfg.buildcfg}", "%{prj.name}")) .. '"'
         -- }
 
+        -- Linux-only libraries (headless rendering through EGL, and the loader thread)
+        configuration "linux"
+            links {
+                "EGL",
+                "GL",
+                "pthread",
+            }
+
         -- Windows-only defines
 		configuration "Win*"
 			defines {
@@ -95,7 +123,87 @@ solution "ascii"
 				--"NoMinimalRebuild",
 				--"NoIncrementalLink",
 			}
+            links {
+                "opengl32.lib"
+            }
             linkoptions {
             }
             --buildoptions { "/std:c++17" }
 
+	-- Offline tool that converts data/font*.png into precompiled .fnt atlases
+	project "fontconv"
+		targetdir "../_bin/%{cfg.platform}_%{cfg.buildcfg}_%{prj.name}"
+		objdir "../_obj/%{cfg.platform}_%{cfg.buildcfg}_%{prj.name}"
+        kind "ConsoleApp"
+		files {
+            "../tools/fontconv.c",
+            "../src/fontatlas.c",
+            "../src/fontatlas.h",
+		}
+        includedirs {
+            "../src",
+            "../modules/kore/include",
+        }
+
+		configuration "Win*"
+			defines {
+				"WIN32",
+			}
+			flags {
+				"StaticRuntime",
+			}
+
+
+	-- Unit tests for the parts that don't need a GPU.  Run the executable; it returns 1 if any test fails.
+	project "tests"
+		targetdir "../_bin/%{cfg.platform}_%{cfg.buildcfg}_%{prj.name}"
+		objdir "../_obj/%{cfg.platform}_%{cfg.buildcfg}_%{prj.name}"
+        kind "ConsoleApp"
+		files {
+            "../tests/**.c",
+            "../tests/**.h",
+            "../src/canvas.c",
+            "../src/cellrow.c",
+            "../src/cpu.c",
+            "../src/damage.c",
+            "../src/fontatlas.c",
+            "../src/glyphslots.c",
+            "../src/journal.c",
+            "../src/pool.c",
+            "../src/raster.c",
+		}
+        includedirs {
+            "../src",
+            "../tests",
+            "../modules/kore/include",
+        }
+
+		configuration "Win*"
+			defines {
+				"WIN32",
+			}
+			flags {
+				"StaticRuntime",
+			}
+
+
+	-- Build tool that generates src/embedded.c from the files in data
+	project "embed"
+		targetdir "../_bin/%{cfg.platform}_%{cfg.buildcfg}_%{prj.name}"
+		objdir "../_obj/%{cfg.platform}_%{cfg.buildcfg}_%{prj.name}"
+        kind "ConsoleApp"
+		files {
+            "../tools/embed.c",
+		}
+        includedirs {
+            "../src",
+            "../modules/kore/include",
+        }
+
+		configuration "Win*"
+			defines {
+				"WIN32",
+			}
+			flags {
+				"StaticRuntime",
+			}
@@ -0,0 +1,71 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       assets.c
+//! @brief      Shaders and fonts built into the executable, with an optional override directory.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <assets.h>
+
+#include <stdio.h>
+#include <string.h>
+
+internal const char* gAssetsDir = 0;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void assetsSetDir(const char* dir)
+{
+    gAssetsDir = (dir && *dir) ? dir : 0;
+}
+
+const char* assetsDir()
+{
+    return gAssetsDir;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+bool assetLoad(Asset* asset, const char* name)
+{
+    memoryClear(asset, sizeof(*asset));
+
+    if (gAssetsDir)
+    {
+        char fileName[1024];
+        snprintf(fileName, sizeof(fileName), "%s/%s", gAssetsDir, name);
+        if (mapFileOpen(&asset->file, fileName))
+        {
+            asset->bytes = asset->file.bytes;
+            asset->size = asset->file.size;
+            asset->onDisk = YES;
+            return YES;
+        }
+    }
+
+    return assetLoadEmbedded(asset, name);
+}
+
+bool assetLoadEmbedded(Asset* asset, const char* name)
+{
+    memoryClear(asset, sizeof(*asset));
+    for (int i = 0; i < gNumEmbeddedAssets; ++i)
+    {
+        if (strcmp(gEmbeddedAssets[i].name, name) == 0)
+        {
+            asset->bytes = gEmbeddedAssets[i].bytes;
+            asset->size = gEmbeddedAssets[i].size;
+            return YES;
+        }
+    }
+
+    return NO;
+}
+
+void assetUnload(Asset* asset)
+{
+    if (asset->onDisk) mapFileClose(&asset->file);
+    memoryClear(asset, sizeof(*asset));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
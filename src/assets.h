@@ -0,0 +1,53 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       assets.h
+//! @brief      Shaders and fonts built into the executable, with an optional override directory.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <mapfile.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// The shaders and precompiled fonts in data are compiled into the executable by tools/embed.c (see embedded.c), so
+// the program starts without touching the file system and doesn't care where it is run from.
+//
+// If an override directory is set, an asset is first looked for there and mapped from disk, which is how to try out
+// a changed shader or font without rebuilding.  Files that are never embedded, such as the PNG fonts, can only come
+// from the override directory.
+//----------------------------------------------------------------------------------------------------------------------
+
+STRUCT_START(EmbeddedAsset)
+{
+    const char* name;
+    const u8*   bytes;      // Followed by a zero byte that isn't counted in size
+    i64         size;
+}
+STRUCT_END(EmbeddedAsset);
+
+extern const EmbeddedAsset gEmbeddedAssets[];
+extern const int gNumEmbeddedAssets;
+
+STRUCT_START(Asset)
+{
+    const u8*   bytes;
+    i64         size;
+    bool        onDisk;     // Mapped from the override directory rather than embedded
+    MappedFile  file;
+}
+STRUCT_END(Asset);
+
+// Set the override directory, or 0 to only use the embedded assets.  The string must outlive its use.
+void assetsSetDir(const char* dir);
+const char* assetsDir();
+
+// Find an asset by file name (e.g. "ascii.fs").  Returns NO, with asset cleared, if there is no such asset.  The bytes
+// are not zero-terminated if the asset was mapped from disk.
+bool assetLoad(Asset* asset, const char* name);
+void assetUnload(Asset* asset);
+
+// Find an asset built into the executable, ignoring the override directory.  This never touches the file system.
+bool assetLoadEmbedded(Asset* asset, const char* name);
+
+//----------------------------------------------------------------------------------------------------------------------
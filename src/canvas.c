@@ -0,0 +1,148 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       canvas.c
+//! @brief      Sparse, tiled storage for the world's cells.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <canvas.h>
+#include <cellrow.h>
+
+#include <string.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// Tile directory
+//----------------------------------------------------------------------------------------------------------------------
+
+internal Tile* canvasTile(const Canvas* canvas, int tx, int ty)
+{
+    bool inside = tx >= 0 && ty >= 0 && tx < canvas->tilesW && ty < canvas->tilesH;
+    return inside ? canvas->tiles[ty * canvas->tilesW + tx] : 0;
+}
+
+// Make sure the directory covers tile (tx, ty).  The directory at least doubles in each direction it grows.
+internal void canvasGrowDirectory(Canvas* canvas, int tx, int ty)
+{
+    if (tx < canvas->tilesW && ty < canvas->tilesH) return;
+
+    int newW = tx < canvas->tilesW ? canvas->tilesW : K_MAX(tx + 1, canvas->tilesW * 2);
+    int newH = ty < canvas->tilesH ? canvas->tilesH : K_MAX(ty + 1, canvas->tilesH * 2);
+    Tile** tiles = K_ALLOC_CLEAR(newW * newH * sizeof(Tile*));
+
+    for (int row = 0; row < canvas->tilesH; ++row)
+    {
+        memcpy(tiles + row * newW, canvas->tiles + row * canvas->tilesW, canvas->tilesW * sizeof(Tile*));
+    }
+
+    K_FREE(canvas->tiles, canvas->tilesW * canvas->tilesH * sizeof(Tile*));
+    canvas->tiles = tiles;
+    canvas->tilesW = newW;
+    canvas->tilesH = newH;
+}
+
+// Return the tile (tx, ty), allocating it if it doesn't exist yet.
+internal Tile* canvasTouch(Canvas* canvas, int tx, int ty)
+{
+    canvasGrowDirectory(canvas, tx, ty);
+
+    Tile** slot = &canvas->tiles[ty * canvas->tilesW + tx];
+    if (!*slot)
+    {
+        Tile* tile = poolAlloc(&canvas->tilePool);
+        cellFill(tile->cells, canvas->clear, TILE_SIZE * TILE_SIZE);
+        *slot = tile;
+        ++canvas->numTiles;
+    }
+
+    return *slot;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Lifetime
+//----------------------------------------------------------------------------------------------------------------------
+
+void canvasInit(Canvas* canvas, Cell clear)
+{
+    memoryClear(canvas, sizeof(Canvas));
+    poolInit(&canvas->tilePool, sizeof(Tile), 64);
+    canvas->clear = clear;
+}
+
+void canvasDone(Canvas* canvas)
+{
+    poolDone(&canvas->tilePool);
+    K_FREE(canvas->tiles, canvas->tilesW * canvas->tilesH * sizeof(Tile*));
+    canvasInit(canvas, canvas->clear);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Access
+//----------------------------------------------------------------------------------------------------------------------
+
+Cell canvasGet(const Canvas* canvas, int x, int y)
+{
+    const Tile* tile = canvasTile(canvas, x >> TILE_SHIFT, y >> TILE_SHIFT);
+    return tile ? tile->cells[(y & TILE_MASK) * TILE_SIZE + (x & TILE_MASK)] : canvas->clear;
+}
+
+void canvasRead(const Canvas* canvas, int x, int y, int w, int h, Cell* dst, int dstStride)
+{
+    for (int row = 0; row < h; ++row, dst += dstStride)
+    {
+        int yy = y + row;
+        int ty = yy >> TILE_SHIFT;
+        int rowOffset = (yy & TILE_MASK) * TILE_SIZE;
+        Cell* d = dst;
+
+        // Walk the row one tile-span at a time.
+        for (int xx = x; xx < x + w;)
+        {
+            int span = K_MIN(TILE_SIZE - (xx & TILE_MASK), x + w - xx);
+            const Tile* tile = canvasTile(canvas, xx >> TILE_SHIFT, ty);
+            if (tile)
+            {
+                cellCopy(d, &tile->cells[rowOffset + (xx & TILE_MASK)], span);
+            }
+            else
+            {
+                cellFill(d, canvas->clear, span);
+            }
+            d += span;
+            xx += span;
+        }
+    }
+}
+
+void canvasWrite(Canvas* canvas, int x, int y, int w, int h, const Cell* src, int srcStride)
+{
+    if (w <= 0 || h <= 0) return;
+
+    for (int row = 0; row < h; ++row, src += srcStride)
+    {
+        int yy = y + row;
+        int ty = yy >> TILE_SHIFT;
+        int rowOffset = (yy & TILE_MASK) * TILE_SIZE;
+        const Cell* s = src;
+
+        for (int xx = x; xx < x + w;)
+        {
+            int span = K_MIN(TILE_SIZE - (xx & TILE_MASK), x + w - xx);
+            Tile* tile = canvasTouch(canvas, xx >> TILE_SHIFT, ty);
+            cellCopy(&tile->cells[rowOffset + (xx & TILE_MASK)], s, span);
+            s += span;
+            xx += span;
+        }
+    }
+
+    damageAdd(&canvas->damage, x, y, w, h);
+
+    // Growing the extent changes every cell in the newly covered strips from outside to clear.
+    int newW = K_MAX(canvas->w, x + w);
+    int newH = K_MAX(canvas->h, y + h);
+    damageAdd(&canvas->damage, canvas->w, 0, newW - canvas->w, newH);
+    damageAdd(&canvas->damage, 0, canvas->h, newW, newH - canvas->h);
+    canvas->w = newW;
+    canvas->h = newH;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
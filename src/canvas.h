@@ -0,0 +1,55 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       canvas.h
+//! @brief      Sparse, tiled storage for the world's cells.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <game.h>
+#include <pool.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// The canvas is split into fixed-size square tiles that are only allocated when something is written to them.  A
+// directory of tile pointers (row-major, NULL for empty tiles) covers the written area and grows geometrically, so a
+// write far from the origin costs the tiles it touches plus, occasionally, a directory copy of pointers.
+//----------------------------------------------------------------------------------------------------------------------
+
+#define TILE_SHIFT      5
+#define TILE_SIZE       (1 << TILE_SHIFT)
+#define TILE_MASK       (TILE_SIZE - 1)
+
+STRUCT_START(Tile)
+{
+    Cell    cells[TILE_SIZE * TILE_SIZE];
+}
+STRUCT_END(Tile);
+
+STRUCT_START(Canvas)
+{
+    Tile**  tiles;          // Tile directory (tilesW * tilesH entries)
+    int     tilesW;         // Directory width in tiles
+    int     tilesH;         // Directory height in tiles
+    int     w, h;           // Extent of the written area in cells
+    int     numTiles;       // Number of allocated tiles
+    Pool    tilePool;       // Storage for the tiles
+    Cell    clear;          // Value of cells that have never been written
+    Damage  damage;         // Areas written since the damage was last cleared (including growth of the extent)
+}
+STRUCT_END(Canvas);
+
+void canvasInit(Canvas* canvas, Cell clear);
+void canvasDone(Canvas* canvas);
+
+// Read a single cell.  Cells that have never been written, including any at negative coords, return the clear cell.
+Cell canvasGet(const Canvas* canvas, int x, int y);
+
+// Copy the rectangle (x, y, w, h) of the canvas into dst, whose rows are dstStride cells apart.
+void canvasRead(const Canvas* canvas, int x, int y, int w, int h, Cell* dst, int dstStride);
+
+// Copy src, whose rows are srcStride cells apart, into the rectangle (x, y, w, h) of the canvas.  Only the tiles
+// covered by the rectangle are allocated.  x and y must not be negative.
+void canvasWrite(Canvas* canvas, int x, int y, int w, int h, const Cell* src, int srcStride);
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,213 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       cellrow.c
+//! @brief      Copying and filling runs of cells.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <cellrow.h>
+
+#include <string.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// Scalar
+//----------------------------------------------------------------------------------------------------------------------
+
+internal void cellCopyScalar(Cell* dst, const Cell* src, int count)
+{
+    for (int i = 0; i < count; ++i) dst[i] = src[i];
+}
+
+internal void cellFillScalar(Cell* dst, Cell value, int count)
+{
+    for (int i = 0; i < count; ++i) dst[i] = value;
+}
+
+#if CPU_X86
+
+// A cell is one 64-bit word.  Broadcasting it from a register rather than loading vectors from an array of cells on
+// the stack avoids a store-forwarding stall on every fill.
+internal i64 cellPattern(Cell value)
+{
+    i64 v;
+    memcpy(&v, &value, sizeof(Cell));
+    return v;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// SSE2
+//----------------------------------------------------------------------------------------------------------------------
+
+// Copies work in bytes, so they don't depend on the size of a cell.
+internal void bytesCopySse2(u8* d, const u8* s, size_t bytes)
+{
+    for (; bytes >= 64; bytes -= 64, d += 64, s += 64)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i*)(s + 0));
+        __m128i b = _mm_loadu_si128((const __m128i*)(s + 16));
+        __m128i c = _mm_loadu_si128((const __m128i*)(s + 32));
+        __m128i e = _mm_loadu_si128((const __m128i*)(s + 48));
+        _mm_storeu_si128((__m128i*)(d + 0), a);
+        _mm_storeu_si128((__m128i*)(d + 16), b);
+        _mm_storeu_si128((__m128i*)(d + 32), c);
+        _mm_storeu_si128((__m128i*)(d + 48), e);
+    }
+    for (; bytes >= 16; bytes -= 16, d += 16, s += 16)
+    {
+        _mm_storeu_si128((__m128i*)d, _mm_loadu_si128((const __m128i*)s));
+    }
+    memcpy(d, s, bytes);
+}
+
+internal void cellCopySse2(Cell* dst, const Cell* src, int count)
+{
+    bytesCopySse2((u8*)dst, (const u8*)src, (size_t)count * sizeof(Cell));
+}
+
+internal void cellFillSse2(Cell* dst, Cell value, int count)
+{
+    __m128i p = _mm_set1_epi64x(cellPattern(value));
+    u8* d = (u8*)dst;
+
+    for (; count >= 8; count -= 8, d += 64)
+    {
+        _mm_storeu_si128((__m128i*)(d + 0), p);
+        _mm_storeu_si128((__m128i*)(d + 16), p);
+        _mm_storeu_si128((__m128i*)(d + 32), p);
+        _mm_storeu_si128((__m128i*)(d + 48), p);
+    }
+    for (; count >= 2; count -= 2, d += 16)
+    {
+        _mm_storeu_si128((__m128i*)d, p);
+    }
+
+    cellFillScalar((Cell*)d, value, count);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// AVX2
+//----------------------------------------------------------------------------------------------------------------------
+
+TARGET_AVX2 internal void cellCopyAvx2(Cell* dst, const Cell* src, int count)
+{
+    u8* d = (u8*)dst;
+    const u8* s = (const u8*)src;
+    size_t bytes = (size_t)count * sizeof(Cell);
+
+    for (; bytes >= 128; bytes -= 128, d += 128, s += 128)
+    {
+        __m256i a = _mm256_loadu_si256((const __m256i*)(s + 0));
+        __m256i b = _mm256_loadu_si256((const __m256i*)(s + 32));
+        __m256i c = _mm256_loadu_si256((const __m256i*)(s + 64));
+        __m256i e = _mm256_loadu_si256((const __m256i*)(s + 96));
+        _mm256_storeu_si256((__m256i*)(d + 0), a);
+        _mm256_storeu_si256((__m256i*)(d + 32), b);
+        _mm256_storeu_si256((__m256i*)(d + 64), c);
+        _mm256_storeu_si256((__m256i*)(d + 96), e);
+    }
+    for (; bytes >= 32; bytes -= 32, d += 32, s += 32)
+    {
+        _mm256_storeu_si256((__m256i*)d, _mm256_loadu_si256((const __m256i*)s));
+    }
+    if (bytes >= 16)
+    {
+        _mm_storeu_si128((__m128i*)d, _mm_loadu_si128((const __m128i*)s));
+        bytes -= 16;
+        d += 16;
+        s += 16;
+    }
+    for (; bytes; --bytes) *d++ = *s++;
+}
+
+TARGET_AVX2 internal void cellFillAvx2(Cell* dst, Cell value, int count)
+{
+    __m256i p = _mm256_set1_epi64x(cellPattern(value));
+    u8* d = (u8*)dst;
+
+    for (; count >= 16; count -= 16, d += 128)
+    {
+        _mm256_storeu_si256((__m256i*)(d + 0), p);
+        _mm256_storeu_si256((__m256i*)(d + 32), p);
+        _mm256_storeu_si256((__m256i*)(d + 64), p);
+        _mm256_storeu_si256((__m256i*)(d + 96), p);
+    }
+    for (; count >= 4; count -= 4, d += 32)
+    {
+        _mm256_storeu_si256((__m256i*)d, p);
+    }
+    if (count >= 2)
+    {
+        _mm_storeu_si128((__m128i*)d, _mm256_castsi256_si128(p));
+        count -= 2;
+        d += 16;
+    }
+
+    // Finish here rather than calling the SSE2 version: the compiler may turn that into a tail call that skips the
+    // vzeroupper, and legacy SSE code after dirty AVX state runs many times slower.
+    Cell* c = (Cell*)d;
+    for (int i = 0; i < count; ++i) c[i] = value;
+}
+
+#endif // CPU_X86
+
+//----------------------------------------------------------------------------------------------------------------------
+// Dispatch
+//----------------------------------------------------------------------------------------------------------------------
+
+CellCopyFunc cellCopyFunc(SimdPath path)
+{
+#if CPU_X86
+    switch (path)
+    {
+    case SIMD_AVX2:     return cpuHasAvx2() ? &cellCopyAvx2 : &cellCopySse2;
+    case SIMD_SSE2:     return &cellCopySse2;
+    default:            break;
+    }
+#endif
+    return &cellCopyScalar;
+}
+
+CellFillFunc cellFillFunc(SimdPath path)
+{
+#if CPU_X86
+    switch (path)
+    {
+    case SIMD_AVX2:     return cpuHasAvx2() ? &cellFillAvx2 : &cellFillSse2;
+    case SIMD_SSE2:     return &cellFillSse2;
+    default:            break;
+    }
+#endif
+    return &cellFillScalar;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+internal CellCopyFunc gCellCopy = 0;
+internal CellFillFunc gCellFill = 0;
+
+void cellCopy(Cell* dst, const Cell* src, int count)
+{
+    if (!gCellCopy) gCellCopy = cellCopyFunc(cpuBestPath());
+    gCellCopy(dst, src, count);
+}
+
+void cellFill(Cell* dst, Cell value, int count)
+{
+    if (!gCellFill) gCellFill = cellFillFunc(cpuBestPath());
+    gCellFill(dst, value, count);
+}
+
+void cellCopyRects(Cell* dst, const Cell* src, int pitch, const Damage* damage)
+{
+    for (int i = 0; i < damage->count; ++i)
+    {
+        const DamageRect* r = &damage->rects[i];
+        for (int y = r->y; y < r->y + r->h; ++y)
+        {
+            i64 offset = (i64)y * pitch + r->x;
+            cellCopy(dst + offset, src + offset, r->w);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,31 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       cellrow.h
+//! @brief      Copying and filling runs of cells.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cpu.h>
+#include <game.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// Cells are 8 bytes, so a fill is one 64-bit pattern broadcast across 16-byte or 32-byte vectors.  cellCopy() and
+// cellFill() use the fastest path for this CPU; the others are there for benchmarks.
+//----------------------------------------------------------------------------------------------------------------------
+
+typedef void (*CellCopyFunc)(Cell* dst, const Cell* src, int count);
+typedef void (*CellFillFunc)(Cell* dst, Cell value, int count);
+
+CellCopyFunc cellCopyFunc(SimdPath path);
+CellFillFunc cellFillFunc(SimdPath path);
+
+void cellCopy(Cell* dst, const Cell* src, int count);
+void cellFill(Cell* dst, Cell value, int count);
+
+// Copy the damaged rectangles of an image into another of the same size, whose rows are both pitch cells apart.  The
+// rest of dst is left alone.
+void cellCopyRects(Cell* dst, const Cell* src, int pitch, const Damage* damage);
+
+//----------------------------------------------------------------------------------------------------------------------
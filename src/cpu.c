@@ -0,0 +1,65 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       cpu.c
+//! @brief      CPU feature detection for SIMD code paths.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <cpu.h>
+
+#if defined(_MSC_VER)
+#   include <intrin.h>
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+
+internal bool cpuDetectAvx2()
+{
+#if !CPU_X86
+    return NO;
+#elif defined(_MSC_VER)
+    int info[4];
+
+    __cpuid(info, 0);
+    if (info[0] < 7) return NO;
+
+    // The OS must save the YMM registers (OSXSAVE, then XCR0 bits 1 and 2).
+    __cpuid(info, 1);
+    if (!(info[2] & (1 << 27))) return NO;
+    if ((_xgetbv(0) & 6) != 6) return NO;
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+bool cpuHasAvx2()
+{
+    static int hasAvx2 = -1;
+    if (hasAvx2 < 0) hasAvx2 = cpuDetectAvx2() ? 1 : 0;
+    return hasAvx2 != 0;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+SimdPath cpuBestPath()
+{
+#if CPU_X86
+    return cpuHasAvx2() ? SIMD_AVX2 : SIMD_SSE2;
+#else
+    return SIMD_SCALAR;
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+const char* cpuPathName(SimdPath path)
+{
+    static const char* kNames[SIMD_COUNT] = { "scalar", "sse2", "avx2" };
+    return (path >= 0 && path < SIMD_COUNT) ? kNames[path] : "?";
+}
+
+//----------------------------------------------------------------------------------------------------------------------
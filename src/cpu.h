@@ -0,0 +1,51 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       cpu.h
+//! @brief      CPU feature detection for SIMD code paths.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <kore/kore.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// CPU_X86 is defined when building for x86/x64, where SSE2 is always available and AVX2 may be selected at runtime.
+// Functions using AVX2 intrinsics must be marked with TARGET_AVX2 so GCC and Clang generate code for them without
+// compiling the whole program for AVX2.  MSVC needs no marking.
+//----------------------------------------------------------------------------------------------------------------------
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#   define CPU_X86 1
+#   include <immintrin.h>
+#else
+#   define CPU_X86 0
+#endif
+
+#if defined(_MSC_VER)
+#   define TARGET_AVX2
+#else
+#   define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+// Code paths for kernels with SIMD versions.
+typedef enum
+{
+    SIMD_SCALAR,
+    SIMD_SSE2,
+    SIMD_AVX2,
+
+    SIMD_COUNT
+}
+SimdPath;
+
+// Returns YES if the CPU and operating system support AVX2.
+bool cpuHasAvx2();
+
+// The fastest path supported by this CPU.
+SimdPath cpuBestPath();
+
+// Returns the path's name for reports.
+const char* cpuPathName(SimdPath path);
+
+//----------------------------------------------------------------------------------------------------------------------
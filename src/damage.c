@@ -0,0 +1,83 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       damage.c
+//! @brief      Damage rectangle tracking.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <game.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+
+internal i64 rectArea(const DamageRect* r)
+{
+    return (i64)r->w * r->h;
+}
+
+internal DamageRect rectUnion(const DamageRect* a, const DamageRect* b)
+{
+    DamageRect r;
+    r.x = K_MIN(a->x, b->x);
+    r.y = K_MIN(a->y, b->y);
+    r.w = K_MAX(a->x + a->w, b->x + b->w) - r.x;
+    r.h = K_MAX(a->y + a->h, b->y + b->h) - r.y;
+    return r;
+}
+
+// Returns YES if the rectangles overlap or share an edge.
+internal bool rectTouches(const DamageRect* a, const DamageRect* b)
+{
+    return
+        a->x <= b->x + b->w && b->x <= a->x + a->w &&
+        a->y <= b->y + b->h && b->y <= a->y + a->h;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void damageClear(Damage* damage)
+{
+    damage->count = 0;
+    damage->palette = NO;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void damageAdd(Damage* damage, int x, int y, int w, int h)
+{
+    if (w <= 0 || h <= 0) return;
+
+    DamageRect r = { x, y, w, h };
+
+    // Adjacent or overlapping damage (such as a line of typing) grows an existing rectangle.
+    for (int i = 0; i < damage->count; ++i)
+    {
+        if (rectTouches(&damage->rects[i], &r))
+        {
+            damage->rects[i] = rectUnion(&damage->rects[i], &r);
+            return;
+        }
+    }
+
+    if (damage->count < MAX_DAMAGE_RECTS)
+    {
+        damage->rects[damage->count++] = r;
+        return;
+    }
+
+    // Out of rectangles: merge with the one that grows the least.
+    int best = 0;
+    i64 bestGrowth = 0;
+    for (int i = 0; i < damage->count; ++i)
+    {
+        DamageRect u = rectUnion(&damage->rects[i], &r);
+        i64 growth = rectArea(&u) - rectArea(&damage->rects[i]);
+        if (i == 0 || growth < bestGrowth)
+        {
+            best = i;
+            bestGrowth = growth;
+        }
+    }
+    damage->rects[best] = rectUnion(&damage->rects[best], &r);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,2865 @@
+//----------------------------------------------------------------------------------------------------------------------
+// Generated by tools/embed.c from the files in data - do not edit.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <assets.h>
+
+// ascii.vs: 194 bytes
+internal const u8 kAsset0[] =
+{
+    0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x30, 0x30, 0x0a, 0x0a, 0x6c, 0x61,
+    0x79, 0x6f, 0x75, 0x74, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20,
+    0x30, 0x29, 0x20, 0x69, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x3b, 0x09, 0x09, 0x2f,
+    0x2f, 0x20, 0x32, 0x44, 0x20, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x5b,
+    0x2d, 0x31, 0x2c, 0x20, 0x2b, 0x31, 0x5d, 0x0a, 0x0a, 0x6f, 0x75, 0x74, 0x20, 0x76, 0x65, 0x63,
+    0x32, 0x20, 0x74, 0x65, 0x78, 0x43, 0x6f, 0x6f, 0x72, 0x64, 0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69,
+    0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x28, 0x29, 0x0a, 0x7b, 0x0a, 0x09, 0x76, 0x65, 0x63, 0x32,
+    0x20, 0x76, 0x76, 0x20, 0x3d, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x76, 0x2e, 0x78, 0x2c, 0x20,
+    0x2d, 0x76, 0x2e, 0x79, 0x29, 0x3b, 0x0a, 0x09, 0x67, 0x6c, 0x5f, 0x50, 0x6f, 0x73, 0x69, 0x74,
+    0x69, 0x6f, 0x6e, 0x2e, 0x78, 0x79, 0x20, 0x3d, 0x20, 0x76, 0x76, 0x3b, 0x0a, 0x09, 0x67, 0x6c,
+    0x5f, 0x50, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x7a, 0x77, 0x20, 0x3d, 0x20, 0x76,
+    0x65, 0x63, 0x32, 0x28, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x7d,
+    0x0a, 0x0a, 0x00,
+};
+
+// ascii.fs: 4297 bytes
+internal const u8 kAsset1[] =
+{
+    0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x30, 0x30, 0x0a, 0x0a, 0x6c, 0x61,
+    0x79, 0x6f, 0x75, 0x74, 0x28, 0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x5f, 0x75, 0x70, 0x70, 0x65,
+    0x72, 0x5f, 0x6c, 0x65, 0x66, 0x74, 0x29, 0x20, 0x69, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20,
+    0x67, 0x6c, 0x5f, 0x46, 0x72, 0x61, 0x67, 0x43, 0x6f, 0x6f, 0x72, 0x64, 0x3b, 0x0a, 0x0a, 0x6f,
+    0x75, 0x74, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x3b, 0x0a,
+    0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x75, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65,
+    0x72, 0x32, 0x44, 0x41, 0x72, 0x72, 0x61, 0x79, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x54, 0x65, 0x78,
+    0x3b, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x47, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x72, 0x6f,
+    0x77, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x73, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x20, 0x28,
+    0x79, 0x2c, 0x20, 0x67, 0x2c, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x29, 0x20, 0x69, 0x73, 0x20, 0x72,
+    0x6f, 0x77, 0x20, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x67, 0x2c,
+    0x20, 0x62, 0x69, 0x74, 0x20, 0x78, 0x20, 0x73, 0x65, 0x74, 0x20, 0x69, 0x66, 0x20, 0x6c, 0x69,
+    0x74, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x75, 0x73, 0x61, 0x6d, 0x70, 0x6c,
+    0x65, 0x72, 0x32, 0x44, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x54, 0x65, 0x78, 0x3b, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x47, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x63,
+    0x61, 0x63, 0x68, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x20, 0x28, 0x79, 0x2c, 0x20,
+    0x73, 0x6c, 0x6f, 0x74, 0x29, 0x20, 0x69, 0x73, 0x20, 0x72, 0x6f, 0x77, 0x20, 0x79, 0x20, 0x6f,
+    0x66, 0x20, 0x61, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x64, 0x72, 0x61, 0x77, 0x6e, 0x20,
+    0x74, 0x6f, 0x20, 0x66, 0x69, 0x74, 0x20, 0x69, 0x74, 0x73, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x0a,
+    0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x75, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72,
+    0x32, 0x44, 0x41, 0x72, 0x72, 0x61, 0x79, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x4d, 0x61, 0x70,
+    0x3b, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x47, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x6f, 0x66, 0x20,
+    0x65, 0x61, 0x63, 0x68, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x63,
+    0x20, 0x69, 0x6e, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x3a, 0x20, 0x74,
+    0x65, 0x78, 0x65, 0x6c, 0x20, 0x28, 0x63, 0x20, 0x26, 0x20, 0x32, 0x35, 0x35, 0x2c, 0x20, 0x63,
+    0x20, 0x3e, 0x3e, 0x20, 0x38, 0x2c, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x29, 0x0a, 0x75, 0x6e, 0x69,
+    0x66, 0x6f, 0x72, 0x6d, 0x20, 0x75, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x20,
+    0x63, 0x65, 0x6c, 0x6c, 0x54, 0x65, 0x78, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d,
+    0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x31, 0x44, 0x20, 0x70, 0x61, 0x6c, 0x65, 0x74,
+    0x74, 0x65, 0x54, 0x65, 0x78, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+    0x43, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70,
+    0x61, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x28, 0x73, 0x65,
+    0x65, 0x20, 0x50, 0x41, 0x4c, 0x45, 0x54, 0x54, 0x45, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x20, 0x69,
+    0x6e, 0x20, 0x67, 0x61, 0x6d, 0x65, 0x2e, 0x68, 0x29, 0x0a, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f,
+    0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x75, 0x46, 0x6f, 0x6e, 0x74, 0x52, 0x65, 0x73,
+    0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x75, 0x46,
+    0x6f, 0x6e, 0x74, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x2f, 0x2f, 0x20, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x6f,
+    0x6e, 0x74, 0x54, 0x65, 0x78, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x4d,
+    0x61, 0x70, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x20, 0x75, 0x73, 0x69,
+    0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x72, 0x69, 0x64, 0x27, 0x73, 0x20, 0x66, 0x6f,
+    0x6e, 0x74, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20,
+    0x75, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3b, 0x0a, 0x0a, 0x75, 0x6e,
+    0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x76, 0x65, 0x63, 0x32, 0x20, 0x75, 0x56, 0x69, 0x65,
+    0x77, 0x4f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+    0x20, 0x43, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x20, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x73, 0x20, 0x6f,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x6f, 0x70, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x20, 0x63,
+    0x65, 0x6c, 0x6c, 0x20, 0x6f, 0x6e, 0x20, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x0a, 0x0a, 0x75,
+    0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x76, 0x65, 0x63, 0x32, 0x20, 0x75, 0x43, 0x75,
+    0x72, 0x73, 0x6f, 0x72, 0x50, 0x6f, 0x73, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
+    0x2f, 0x20, 0x43, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x20, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x73, 0x20,
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x20, 0x75, 0x6e, 0x64, 0x65,
+    0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x0a, 0x75, 0x6e, 0x69,
+    0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x75, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72,
+    0x53, 0x74, 0x79, 0x6c, 0x65, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+    0x43, 0x55, 0x52, 0x53, 0x4f, 0x52, 0x5f, 0x78, 0x78, 0x78, 0x20, 0x69, 0x6e, 0x20, 0x67, 0x61,
+    0x6d, 0x65, 0x2e, 0x68, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x75, 0x76, 0x65,
+    0x63, 0x32, 0x20, 0x75, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x43, 0x6f, 0x6c, 0x6f, 0x75, 0x72,
+    0x73, 0x3b, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x50, 0x61, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x20,
+    0x69, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x3a, 0x20, 0x78, 0x20, 0x3d, 0x20, 0x63, 0x75, 0x72,
+    0x73, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x2c, 0x20, 0x79, 0x20, 0x3d, 0x20,
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x20, 0x75, 0x6e, 0x64,
+    0x65, 0x72, 0x20, 0x61, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6f,
+    0x72, 0x0a, 0x0a, 0x2f, 0x2f, 0x20, 0x43, 0x65, 0x6c, 0x6c, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69,
+    0x62, 0x75, 0x74, 0x65, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x28, 0x73, 0x65, 0x65, 0x20, 0x43,
+    0x45, 0x4c, 0x4c, 0x5f, 0x41, 0x54, 0x54, 0x52, 0x5f, 0x78, 0x78, 0x78, 0x20, 0x69, 0x6e, 0x20,
+    0x67, 0x61, 0x6d, 0x65, 0x2e, 0x68, 0x29, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x69,
+    0x6e, 0x74, 0x20, 0x6b, 0x41, 0x74, 0x74, 0x72, 0x49, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20,
+    0x3d, 0x20, 0x31, 0x75, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74,
+    0x20, 0x6b, 0x41, 0x74, 0x74, 0x72, 0x55, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x20,
+    0x3d, 0x20, 0x32, 0x75, 0x3b, 0x0a, 0x0a, 0x2f, 0x2f, 0x20, 0x4d, 0x61, 0x70, 0x20, 0x65, 0x6e,
+    0x74, 0x72, 0x69, 0x65, 0x73, 0x20, 0x75, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x69, 0x73,
+    0x20, 0x61, 0x72, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73,
+    0x2c, 0x20, 0x61, 0x62, 0x6f, 0x76, 0x65, 0x20, 0x69, 0x74, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68,
+    0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x73, 0x6c, 0x6f, 0x74, 0x73, 0x20, 0x28, 0x73, 0x65,
+    0x65, 0x20, 0x47, 0x4c, 0x59, 0x50, 0x48, 0x5f, 0x4d, 0x41, 0x50, 0x5f, 0x46, 0x4f, 0x4e, 0x54,
+    0x5f, 0x47, 0x4c, 0x59, 0x50, 0x48, 0x53, 0x20, 0x69, 0x6e, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68,
+    0x63, 0x61, 0x63, 0x68, 0x65, 0x2e, 0x68, 0x29, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75,
+    0x69, 0x6e, 0x74, 0x20, 0x6b, 0x46, 0x6f, 0x6e, 0x74, 0x47, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20,
+    0x3d, 0x20, 0x32, 0x35, 0x36, 0x75, 0x3b, 0x0a, 0x0a, 0x2f, 0x2f, 0x20, 0x43, 0x75, 0x72, 0x73,
+    0x6f, 0x72, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x20, 0x28, 0x73, 0x65, 0x65, 0x20, 0x43,
+    0x55, 0x52, 0x53, 0x4f, 0x52, 0x5f, 0x78, 0x78, 0x78, 0x20, 0x69, 0x6e, 0x20, 0x67, 0x61, 0x6d,
+    0x65, 0x2e, 0x68, 0x29, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6b,
+    0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x3d, 0x20, 0x31, 0x3b,
+    0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6b, 0x43, 0x75, 0x72, 0x73,
+    0x6f, 0x72, 0x55, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x3d, 0x20, 0x32, 0x3b,
+    0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6b, 0x43, 0x75, 0x72, 0x73,
+    0x6f, 0x72, 0x42, 0x61, 0x72, 0x20, 0x3d, 0x20, 0x33, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+    0x20, 0x69, 0x6e, 0x74, 0x20, 0x6b, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x54, 0x68, 0x69, 0x63,
+    0x6b, 0x6e, 0x65, 0x73, 0x73, 0x20, 0x3d, 0x20, 0x32, 0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+    0x20, 0x63, 0x61, 0x6c, 0x63, 0x43, 0x6f, 0x6f, 0x72, 0x64, 0x73, 0x28, 0x69, 0x6e, 0x20, 0x76,
+    0x65, 0x63, 0x32, 0x20, 0x66, 0x78, 0x79, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x69, 0x6e, 0x74,
+    0x20, 0x78, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x79, 0x2c, 0x20, 0x6f,
+    0x75, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x78, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x69,
+    0x6e, 0x74, 0x20, 0x63, 0x79, 0x29, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x78, 0x20,
+    0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x66, 0x78, 0x79, 0x2e, 0x78, 0x29, 0x20, 0x2f, 0x20, 0x69,
+    0x6e, 0x74, 0x28, 0x75, 0x46, 0x6f, 0x6e, 0x74, 0x52, 0x65, 0x73, 0x2e, 0x78, 0x29, 0x3b, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x63, 0x79, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x66, 0x78, 0x79,
+    0x2e, 0x79, 0x29, 0x20, 0x2f, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x75, 0x46, 0x6f, 0x6e, 0x74, 0x52,
+    0x65, 0x73, 0x2e, 0x79, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x78, 0x20, 0x3d, 0x20, 0x69,
+    0x6e, 0x74, 0x28, 0x66, 0x78, 0x79, 0x2e, 0x78, 0x29, 0x20, 0x25, 0x20, 0x69, 0x6e, 0x74, 0x28,
+    0x75, 0x46, 0x6f, 0x6e, 0x74, 0x52, 0x65, 0x73, 0x2e, 0x78, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x79, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x66, 0x78, 0x79, 0x2e, 0x79, 0x29, 0x20,
+    0x25, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x75, 0x46, 0x6f, 0x6e, 0x74, 0x52, 0x65, 0x73, 0x2e, 0x79,
+    0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x28,
+    0x29, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x78, 0x2c, 0x20, 0x79,
+    0x2c, 0x20, 0x63, 0x78, 0x2c, 0x20, 0x63, 0x79, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f,
+    0x2f, 0x20, 0x28, 0x63, 0x78, 0x2c, 0x20, 0x63, 0x79, 0x29, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x6f, 0x72,
+    0x64, 0x73, 0x2c, 0x20, 0x28, 0x78, 0x2c, 0x20, 0x79, 0x29, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x6e, 0x61, 0x6c, 0x20, 0x63, 0x6f, 0x6f, 0x72, 0x64,
+    0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74,
+    0x65, 0x72, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61,
+    0x6c, 0x63, 0x43, 0x6f, 0x6f, 0x72, 0x64, 0x73, 0x28, 0x67, 0x6c, 0x5f, 0x46, 0x72, 0x61, 0x67,
+    0x43, 0x6f, 0x6f, 0x72, 0x64, 0x2e, 0x78, 0x79, 0x2c, 0x20, 0x78, 0x2c, 0x20, 0x79, 0x2c, 0x20,
+    0x63, 0x78, 0x2c, 0x20, 0x63, 0x79, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+    0x20, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x73, 0x20, 0x70, 0x61, 0x73, 0x74, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6c, 0x61, 0x73, 0x74, 0x20, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x20, 0x63, 0x65, 0x6c, 0x6c,
+    0x20, 0x61, 0x72, 0x65, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x20, 0x62, 0x6c, 0x61, 0x63, 0x6b, 0x2e,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x69, 0x65, 0x77, 0x53,
+    0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x53, 0x69, 0x7a,
+    0x65, 0x28, 0x63, 0x65, 0x6c, 0x6c, 0x54, 0x65, 0x78, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x78, 0x20, 0x3e, 0x3d, 0x20, 0x76, 0x69, 0x65,
+    0x77, 0x53, 0x69, 0x7a, 0x65, 0x2e, 0x78, 0x20, 0x7c, 0x7c, 0x20, 0x63, 0x79, 0x20, 0x3e, 0x3d,
+    0x20, 0x76, 0x69, 0x65, 0x77, 0x53, 0x69, 0x7a, 0x65, 0x2e, 0x79, 0x29, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x75,
+    0x72, 0x20, 0x3d, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x46, 0x65, 0x74,
+    0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x3a, 0x20, 0x78, 0x20, 0x3d,
+    0x20, 0x63, 0x6f, 0x64, 0x65, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x79, 0x20, 0x3d, 0x20,
+    0x66, 0x6f, 0x72, 0x65, 0x20, 0x7c, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x3c, 0x3c, 0x20, 0x38,
+    0x20, 0x7c, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x73, 0x20, 0x3c, 0x3c,
+    0x20, 0x31, 0x36, 0x20, 0x7c, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x34,
+    0x2e, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x20, 0x74, 0x65, 0x78, 0x74,
+    0x75, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x61, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+    0x77, 0x72, 0x61, 0x70, 0x2d, 0x61, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x63, 0x61, 0x63, 0x68,
+    0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x69, 0x65, 0x77, 0x70, 0x6f, 0x72,
+    0x74, 0x2c, 0x20, 0x68, 0x6f, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x61, 0x6e, 0x76, 0x61,
+    0x73, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x20, 0x28, 0x78, 0x2c, 0x20, 0x79, 0x29, 0x20, 0x61, 0x74,
+    0x20, 0x28, 0x78, 0x20, 0x25, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x20, 0x79, 0x20, 0x25,
+    0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x29, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x76,
+    0x65, 0x63, 0x32, 0x20, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20,
+    0x69, 0x76, 0x65, 0x63, 0x32, 0x28, 0x63, 0x78, 0x2c, 0x20, 0x63, 0x79, 0x29, 0x20, 0x2b, 0x20,
+    0x75, 0x56, 0x69, 0x65, 0x77, 0x4f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x75, 0x76, 0x65, 0x63, 0x32, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x20, 0x3d, 0x20, 0x74, 0x65,
+    0x78, 0x65, 0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x63, 0x65, 0x6c, 0x6c, 0x54, 0x65, 0x78,
+    0x2c, 0x20, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x50, 0x6f, 0x73, 0x20, 0x25, 0x20, 0x76, 0x69,
+    0x65, 0x77, 0x53, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x30, 0x29, 0x2e, 0x78, 0x79, 0x3b, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x61, 0x74, 0x74, 0x72, 0x20, 0x3d, 0x20, 0x28,
+    0x63, 0x65, 0x6c, 0x6c, 0x2e, 0x79, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x36, 0x29, 0x20, 0x26, 0x20,
+    0x30, 0x78, 0x66, 0x66, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20,
+    0x66, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65, 0x74, 0x63,
+    0x68, 0x28, 0x70, 0x61, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x54, 0x65, 0x78, 0x2c, 0x20, 0x69, 0x6e,
+    0x74, 0x28, 0x63, 0x65, 0x6c, 0x6c, 0x2e, 0x79, 0x20, 0x26, 0x20, 0x30, 0x78, 0x66, 0x66, 0x75,
+    0x29, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20,
+    0x62, 0x61, 0x63, 0x6b, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65, 0x74, 0x63,
+    0x68, 0x28, 0x70, 0x61, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x54, 0x65, 0x78, 0x2c, 0x20, 0x69, 0x6e,
+    0x74, 0x28, 0x28, 0x63, 0x65, 0x6c, 0x6c, 0x2e, 0x79, 0x20, 0x3e, 0x3e, 0x20, 0x38, 0x29, 0x20,
+    0x26, 0x20, 0x30, 0x78, 0x66, 0x66, 0x75, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x41, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x63, 0x75,
+    0x72, 0x73, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x63, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x73, 0x20, 0x69,
+    0x74, 0x73, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x6f,
+    0x6c, 0x20, 0x61, 0x74, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x20, 0x3d, 0x20, 0x63, 0x61, 0x6e,
+    0x76, 0x61, 0x73, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x3d, 0x20, 0x75, 0x43, 0x75, 0x72, 0x73, 0x6f,
+    0x72, 0x50, 0x6f, 0x73, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x74,
+    0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x20, 0x26, 0x26, 0x20, 0x75, 0x43, 0x75, 0x72, 0x73, 0x6f,
+    0x72, 0x53, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x3d, 0x3d, 0x20, 0x6b, 0x43, 0x75, 0x72, 0x73, 0x6f,
+    0x72, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78,
+    0x65, 0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x70, 0x61, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x54,
+    0x65, 0x78, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x75, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x43,
+    0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x73, 0x2e, 0x79, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x3d, 0x20, 0x74, 0x65,
+    0x78, 0x65, 0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x70, 0x61, 0x6c, 0x65, 0x74, 0x74, 0x65,
+    0x54, 0x65, 0x78, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x75, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72,
+    0x43, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x73, 0x2e, 0x78, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28,
+    0x61, 0x74, 0x74, 0x72, 0x20, 0x26, 0x20, 0x6b, 0x41, 0x74, 0x74, 0x72, 0x49, 0x6e, 0x76, 0x65,
+    0x72, 0x73, 0x65, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x75, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x74,
+    0x20, 0x3d, 0x20, 0x66, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x3b, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x3d, 0x20, 0x74, 0x3b, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x54, 0x68,
+    0x65, 0x20, 0x6d, 0x61, 0x70, 0x20, 0x73, 0x61, 0x79, 0x73, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x27, 0x73,
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x63, 0x65, 0x6c, 0x6c, 0x27, 0x73, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x28, 0x43, 0x45,
+    0x4c, 0x4c, 0x5f, 0x46, 0x4f, 0x4e, 0x54, 0x5f, 0x47, 0x52, 0x49, 0x44, 0x20, 0x69, 0x6e, 0x20,
+    0x67, 0x61, 0x6d, 0x65, 0x2e, 0x68, 0x29, 0x3a, 0x20, 0x30, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x62,
+    0x6c, 0x61, 0x6e, 0x6b, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x2b, 0x20, 0x31, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x27, 0x73, 0x20, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x2c, 0x20,
+    0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x63, 0x61, 0x63,
+    0x68, 0x65, 0x20, 0x73, 0x6c, 0x6f, 0x74, 0x20, 0x2b, 0x20, 0x6b, 0x46, 0x6f, 0x6e, 0x74, 0x47,
+    0x6c, 0x79, 0x70, 0x68, 0x73, 0x2e, 0x20, 0x20, 0x4f, 0x6e, 0x65, 0x20, 0x33, 0x32, 0x2d, 0x62,
+    0x69, 0x74, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x20, 0x68, 0x6f, 0x6c, 0x64, 0x73, 0x20, 0x61,
+    0x20, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x20, 0x72, 0x6f, 0x77, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x2c, 0x20,
+    0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x6f, 0x77, 0x73, 0x20, 0x62, 0x65, 0x6c,
+    0x6f, 0x77, 0x20, 0x61, 0x20, 0x73, 0x68, 0x6f, 0x72, 0x74, 0x65, 0x72, 0x20, 0x66, 0x6f, 0x6e,
+    0x74, 0x27, 0x73, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x62,
+    0x6c, 0x61, 0x6e, 0x6b, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x66,
+    0x6f, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x2e, 0x79, 0x20, 0x3e, 0x3e, 0x20,
+    0x32, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x61, 0x79, 0x65,
+    0x72, 0x20, 0x3d, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x75, 0x20, 0x3f,
+    0x20, 0x75, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x3a, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x66, 0x6f, 0x6e,
+    0x74, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74,
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x3d, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x2e, 0x78, 0x20,
+    0x3c, 0x20, 0x36, 0x35, 0x35, 0x33, 0x36, 0x75, 0x20, 0x26, 0x26, 0x20, 0x6c, 0x61, 0x79, 0x65,
+    0x72, 0x20, 0x3c, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x53, 0x69, 0x7a, 0x65, 0x28,
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x4d, 0x61, 0x70, 0x2c, 0x20, 0x30, 0x29, 0x2e, 0x7a, 0x20, 0x3f,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65,
+    0x74, 0x63, 0x68, 0x28, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x4d, 0x61, 0x70, 0x2c, 0x20, 0x69, 0x76,
+    0x65, 0x63, 0x33, 0x28, 0x63, 0x65, 0x6c, 0x6c, 0x2e, 0x78, 0x20, 0x26, 0x20, 0x32, 0x35, 0x35,
+    0x75, 0x2c, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x2e, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x38, 0x2c, 0x20,
+    0x6c, 0x61, 0x79, 0x65, 0x72, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x2e, 0x72, 0x20, 0x3a, 0x20, 0x30,
+    0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x72, 0x6f, 0x77, 0x20,
+    0x3d, 0x20, 0x30, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x67, 0x6c,
+    0x79, 0x70, 0x68, 0x20, 0x3e, 0x20, 0x6b, 0x46, 0x6f, 0x6e, 0x74, 0x47, 0x6c, 0x79, 0x70, 0x68,
+    0x73, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x72, 0x6f, 0x77, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65, 0x74, 0x63,
+    0x68, 0x28, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x54, 0x65, 0x78, 0x2c, 0x20, 0x69, 0x76, 0x65, 0x63,
+    0x32, 0x28, 0x79, 0x2c, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x2d, 0x20, 0x6b, 0x46, 0x6f,
+    0x6e, 0x74, 0x47, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x2e, 0x72, 0x3b,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20,
+    0x69, 0x66, 0x20, 0x28, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x3e, 0x20, 0x30, 0x75, 0x29, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6f,
+    0x77, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x66,
+    0x6f, 0x6e, 0x74, 0x54, 0x65, 0x78, 0x2c, 0x20, 0x69, 0x76, 0x65, 0x63, 0x33, 0x28, 0x79, 0x2c,
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x2d, 0x20, 0x31, 0x75, 0x2c, 0x20, 0x6c, 0x61, 0x79,
+    0x65, 0x72, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x2e, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x6c, 0x69, 0x74, 0x20, 0x3d, 0x20,
+    0x28, 0x28, 0x72, 0x6f, 0x77, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x78, 0x29,
+    0x29, 0x20, 0x26, 0x20, 0x31, 0x75, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x75, 0x3b, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e,
+    0x65, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x61, 0x74, 0x74, 0x72, 0x20, 0x26, 0x20, 0x6b, 0x41, 0x74,
+    0x74, 0x72, 0x55, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x29, 0x20, 0x21, 0x3d, 0x20,
+    0x30, 0x75, 0x29, 0x20, 0x26, 0x26, 0x20, 0x28, 0x79, 0x20, 0x3d, 0x3d, 0x20, 0x69, 0x6e, 0x74,
+    0x28, 0x75, 0x46, 0x6f, 0x6e, 0x74, 0x52, 0x65, 0x73, 0x2e, 0x79, 0x29, 0x20, 0x2d, 0x20, 0x31,
+    0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x6c, 0x69, 0x74,
+    0x20, 0x26, 0x26, 0x20, 0x21, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x29, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
+    0x6c, 0x6f, 0x75, 0x72, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x2e, 0x72, 0x67, 0x62, 0x3b,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
+    0x6c, 0x6f, 0x75, 0x72, 0x20, 0x3d, 0x20, 0x66, 0x6f, 0x72, 0x65, 0x2e, 0x72, 0x67, 0x62, 0x3b,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x55,
+    0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x62, 0x61, 0x72,
+    0x20, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x64, 0x72, 0x61,
+    0x77, 0x6e, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x65, 0x6c, 0x6c,
+    0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x74, 0x43, 0x75, 0x72, 0x73,
+    0x6f, 0x72, 0x20, 0x26, 0x26, 0x20, 0x28, 0x28, 0x75, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x53,
+    0x74, 0x79, 0x6c, 0x65, 0x20, 0x3d, 0x3d, 0x20, 0x6b, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x55,
+    0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x26, 0x26, 0x20, 0x79, 0x20, 0x3e, 0x3d,
+    0x20, 0x69, 0x6e, 0x74, 0x28, 0x75, 0x46, 0x6f, 0x6e, 0x74, 0x52, 0x65, 0x73, 0x2e, 0x79, 0x29,
+    0x20, 0x2d, 0x20, 0x6b, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x54, 0x68, 0x69, 0x63, 0x6b, 0x6e,
+    0x65, 0x73, 0x73, 0x29, 0x20, 0x7c, 0x7c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x75, 0x43,
+    0x75, 0x72, 0x73, 0x6f, 0x72, 0x53, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x3d, 0x3d, 0x20, 0x6b, 0x43,
+    0x75, 0x72, 0x73, 0x6f, 0x72, 0x42, 0x61, 0x72, 0x20, 0x26, 0x26, 0x20, 0x78, 0x20, 0x3c, 0x20,
+    0x6b, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x54, 0x68, 0x69, 0x63, 0x6b, 0x6e, 0x65, 0x73, 0x73,
+    0x29, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c,
+    0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x70, 0x61, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x54, 0x65, 0x78,
+    0x2c, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x75, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x43, 0x6f, 0x6c,
+    0x6f, 0x75, 0x72, 0x73, 0x2e, 0x78, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x2e, 0x72, 0x67, 0x62, 0x3b,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x7d, 0x0a, 0x00,
+};
+
+// cells.vs: 3298 bytes
+internal const u8 kAsset2[] =
+{
+    0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x30, 0x30, 0x0a, 0x0a, 0x2f, 0x2f,
+    0x20, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x64, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x20,
+    0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x65, 0x72, 0x3a, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x71, 0x75,
+    0x61, 0x64, 0x20, 0x70, 0x65, 0x72, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x2e, 0x20, 0x20, 0x54, 0x68,
+    0x65, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x20, 0x69, 0x73, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x65,
+    0x64, 0x20, 0x6f, 0x6e, 0x63, 0x65, 0x20, 0x70, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61,
+    0x6e, 0x63, 0x65, 0x20, 0x68, 0x65, 0x72, 0x65, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x66, 0x72, 0x61, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72,
+    0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x0a, 0x2f, 0x2f, 0x20, 0x68, 0x61, 0x73, 0x20, 0x74, 0x6f, 0x20,
+    0x6c, 0x6f, 0x6f, 0x6b, 0x20, 0x75, 0x70, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70,
+    0x68, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x2e, 0x0a, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74,
+    0x28, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x69,
+    0x6e, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x3b, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x51, 0x75,
+    0x61, 0x64, 0x20, 0x63, 0x6f, 0x72, 0x6e, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x5b, 0x2d, 0x31,
+    0x2c, 0x20, 0x2b, 0x31, 0x5d, 0x0a, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x75,
+    0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x54, 0x65,
+    0x78, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x75, 0x73, 0x61, 0x6d, 0x70,
+    0x6c, 0x65, 0x72, 0x32, 0x44, 0x41, 0x72, 0x72, 0x61, 0x79, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68,
+    0x4d, 0x61, 0x70, 0x3b, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x47, 0x6c, 0x79, 0x70, 0x68, 0x20,
+    0x6f, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x70, 0x6f, 0x69, 0x6e,
+    0x74, 0x20, 0x63, 0x20, 0x69, 0x6e, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x66, 0x6f, 0x6e, 0x74,
+    0x3a, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x20, 0x28, 0x63, 0x20, 0x26, 0x20, 0x32, 0x35, 0x35,
+    0x2c, 0x20, 0x63, 0x20, 0x3e, 0x3e, 0x20, 0x38, 0x2c, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x29, 0x0a,
+    0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x31,
+    0x44, 0x20, 0x70, 0x61, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x54, 0x65, 0x78, 0x3b, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x43, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x20, 0x6f, 0x66,
+    0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x61, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x20, 0x69, 0x6e,
+    0x64, 0x65, 0x78, 0x20, 0x28, 0x73, 0x65, 0x65, 0x20, 0x50, 0x41, 0x4c, 0x45, 0x54, 0x54, 0x45,
+    0x5f, 0x53, 0x49, 0x5a, 0x45, 0x20, 0x69, 0x6e, 0x20, 0x67, 0x61, 0x6d, 0x65, 0x2e, 0x68, 0x29,
+    0x0a, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x75,
+    0x46, 0x6f, 0x6e, 0x74, 0x52, 0x65, 0x73, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d,
+    0x20, 0x69, 0x6e, 0x74, 0x20, 0x75, 0x46, 0x6f, 0x6e, 0x74, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x74, 0x65,
+    0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x4d,
+    0x61, 0x70, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x20, 0x75, 0x73, 0x69,
+    0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x72, 0x69, 0x64, 0x27, 0x73, 0x20, 0x66, 0x6f,
+    0x6e, 0x74, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20,
+    0x75, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3b, 0x0a, 0x75, 0x6e, 0x69,
+    0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x75, 0x43, 0x6f, 0x6c, 0x75, 0x6d, 0x6e,
+    0x73, 0x3b, 0x0a, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x76, 0x65, 0x63,
+    0x32, 0x20, 0x75, 0x56, 0x69, 0x65, 0x77, 0x4f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x3b, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x43, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x20, 0x63, 0x6f,
+    0x6f, 0x72, 0x64, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x6f, 0x70, 0x2d,
+    0x6c, 0x65, 0x66, 0x74, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x20, 0x6f, 0x6e, 0x20, 0x73, 0x63, 0x72,
+    0x65, 0x65, 0x6e, 0x0a, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x76, 0x65,
+    0x63, 0x32, 0x20, 0x75, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x50, 0x6f, 0x73, 0x3b, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x43, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x20, 0x63,
+    0x6f, 0x6f, 0x72, 0x64, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x65, 0x6c,
+    0x6c, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x73,
+    0x6f, 0x72, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x75,
+    0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x53, 0x74, 0x79, 0x6c, 0x65, 0x3b, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x43, 0x55, 0x52, 0x53, 0x4f, 0x52, 0x5f, 0x78, 0x78, 0x78,
+    0x20, 0x69, 0x6e, 0x20, 0x67, 0x61, 0x6d, 0x65, 0x2e, 0x68, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f,
+    0x72, 0x6d, 0x20, 0x75, 0x76, 0x65, 0x63, 0x32, 0x20, 0x75, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72,
+    0x43, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x73, 0x3b, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x50, 0x61,
+    0x6c, 0x65, 0x74, 0x74, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x3a, 0x20, 0x78,
+    0x20, 0x3d, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x75, 0x72,
+    0x2c, 0x20, 0x79, 0x20, 0x3d, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x63, 0x6f, 0x6c, 0x6f,
+    0x75, 0x72, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x61, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+    0x20, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x0a, 0x0a, 0x2f, 0x2f, 0x20, 0x43, 0x65, 0x6c, 0x6c,
+    0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20,
+    0x28, 0x73, 0x65, 0x65, 0x20, 0x43, 0x45, 0x4c, 0x4c, 0x5f, 0x41, 0x54, 0x54, 0x52, 0x5f, 0x78,
+    0x78, 0x78, 0x20, 0x69, 0x6e, 0x20, 0x67, 0x61, 0x6d, 0x65, 0x2e, 0x68, 0x29, 0x0a, 0x63, 0x6f,
+    0x6e, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6b, 0x41, 0x74, 0x74, 0x72, 0x49, 0x6e,
+    0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x3d, 0x20, 0x31, 0x75, 0x3b, 0x0a, 0x0a, 0x2f, 0x2f, 0x20,
+    0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x20, 0x28, 0x73,
+    0x65, 0x65, 0x20, 0x43, 0x55, 0x52, 0x53, 0x4f, 0x52, 0x5f, 0x78, 0x78, 0x78, 0x20, 0x69, 0x6e,
+    0x20, 0x67, 0x61, 0x6d, 0x65, 0x2e, 0x68, 0x29, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x69,
+    0x6e, 0x74, 0x20, 0x6b, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x4e, 0x6f, 0x6e, 0x65, 0x20, 0x3d,
+    0x20, 0x30, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6b, 0x43,
+    0x75, 0x72, 0x73, 0x6f, 0x72, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x3d, 0x20, 0x31, 0x3b, 0x0a,
+    0x0a, 0x66, 0x6c, 0x61, 0x74, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x66,
+    0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x66, 0x6c, 0x61, 0x74, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x76, 0x65,
+    0x63, 0x33, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x3b, 0x0a, 0x66, 0x6c, 0x61, 0x74, 0x20, 0x6f, 0x75,
+    0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x3b, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x4d, 0x61, 0x70, 0x20,
+    0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79,
+    0x70, 0x68, 0x3a, 0x20, 0x30, 0x20, 0x3d, 0x20, 0x62, 0x6c, 0x61, 0x6e, 0x6b, 0x20, 0x28, 0x73,
+    0x65, 0x65, 0x20, 0x61, 0x73, 0x63, 0x69, 0x69, 0x2e, 0x66, 0x73, 0x29, 0x0a, 0x66, 0x6c, 0x61,
+    0x74, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x3b,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+    0x4c, 0x61, 0x79, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e,
+    0x74, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x3a, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+    0x65, 0x6c, 0x6c, 0x27, 0x73, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x6f,
+    0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x72, 0x69, 0x64, 0x27, 0x73, 0x0a, 0x66, 0x6c, 0x61,
+    0x74, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x61, 0x74, 0x74, 0x72, 0x3b,
+    0x0a, 0x66, 0x6c, 0x61, 0x74, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x75,
+    0x72, 0x73, 0x6f, 0x72, 0x53, 0x74, 0x79, 0x6c, 0x65, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x2f, 0x2f, 0x20, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x20, 0x64, 0x72, 0x61, 0x77, 0x6e,
+    0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x20,
+    0x28, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x62,
+    0x61, 0x72, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x29, 0x0a, 0x66, 0x6c, 0x61, 0x74, 0x20, 0x6f, 0x75,
+    0x74, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x43, 0x6f, 0x6c,
+    0x6f, 0x75, 0x72, 0x3b, 0x0a, 0x6f, 0x75, 0x74, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x6c, 0x6f,
+    0x63, 0x61, 0x6c, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x20, 0x63, 0x6f,
+    0x6f, 0x72, 0x64, 0x73, 0x20, 0x69, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x63, 0x65, 0x6c, 0x6c, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x28,
+    0x29, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x78, 0x20, 0x3d,
+    0x20, 0x67, 0x6c, 0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x20, 0x25,
+    0x20, 0x75, 0x43, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x73, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+    0x6e, 0x74, 0x20, 0x63, 0x79, 0x20, 0x3d, 0x20, 0x67, 0x6c, 0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61,
+    0x6e, 0x63, 0x65, 0x49, 0x44, 0x20, 0x2f, 0x20, 0x75, 0x43, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x73,
+    0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x50, 0x65, 0x72, 0x2d, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x3a, 0x20, 0x78, 0x20, 0x3d,
+    0x20, 0x63, 0x6f, 0x64, 0x65, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x79, 0x20, 0x3d, 0x20,
+    0x66, 0x6f, 0x72, 0x65, 0x20, 0x7c, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x3c, 0x3c, 0x20, 0x38,
+    0x20, 0x7c, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x73, 0x20, 0x3c, 0x3c,
+    0x20, 0x31, 0x36, 0x20, 0x7c, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x34,
+    0x2e, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x20, 0x74, 0x65, 0x78, 0x74,
+    0x75, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x61, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+    0x77, 0x72, 0x61, 0x70, 0x2d, 0x61, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x63, 0x61, 0x63, 0x68,
+    0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x69, 0x65, 0x77, 0x70, 0x6f, 0x72,
+    0x74, 0x2c, 0x20, 0x68, 0x6f, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x61, 0x6e, 0x76, 0x61,
+    0x73, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x20, 0x28, 0x78, 0x2c, 0x20, 0x79, 0x29, 0x20, 0x61, 0x74,
+    0x20, 0x28, 0x78, 0x20, 0x25, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x20, 0x79, 0x20, 0x25,
+    0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x29, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x76,
+    0x65, 0x63, 0x32, 0x20, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20,
+    0x69, 0x76, 0x65, 0x63, 0x32, 0x28, 0x63, 0x78, 0x2c, 0x20, 0x63, 0x79, 0x29, 0x20, 0x2b, 0x20,
+    0x75, 0x56, 0x69, 0x65, 0x77, 0x4f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x75, 0x76, 0x65, 0x63, 0x32, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x20, 0x3d, 0x20, 0x74, 0x65,
+    0x78, 0x65, 0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x63, 0x65, 0x6c, 0x6c, 0x54, 0x65, 0x78,
+    0x2c, 0x20, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x50, 0x6f, 0x73, 0x20, 0x25, 0x20, 0x74, 0x65,
+    0x78, 0x74, 0x75, 0x72, 0x65, 0x53, 0x69, 0x7a, 0x65, 0x28, 0x63, 0x65, 0x6c, 0x6c, 0x54, 0x65,
+    0x78, 0x2c, 0x20, 0x30, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x2e, 0x78, 0x79, 0x3b, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x61, 0x74, 0x74, 0x72, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x65, 0x6c, 0x6c, 0x2e, 0x79,
+    0x20, 0x3e, 0x3e, 0x20, 0x31, 0x36, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x66, 0x66, 0x75, 0x3b,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x65,
+    0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x70, 0x61, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x54, 0x65,
+    0x78, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x63, 0x65, 0x6c, 0x6c, 0x2e, 0x79, 0x20, 0x26, 0x20,
+    0x30, 0x78, 0x66, 0x66, 0x75, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x2e, 0x72, 0x67, 0x62, 0x3b, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c,
+    0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x70, 0x61, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x54, 0x65, 0x78,
+    0x2c, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x28, 0x63, 0x65, 0x6c, 0x6c, 0x2e, 0x79, 0x20, 0x3e, 0x3e,
+    0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x66, 0x66, 0x75, 0x29, 0x2c, 0x20, 0x30, 0x29,
+    0x2e, 0x72, 0x67, 0x62, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x41, 0x20,
+    0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x63,
+    0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x73, 0x20, 0x69, 0x74, 0x73, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x3b,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x72, 0x61, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x73, 0x68,
+    0x61, 0x64, 0x65, 0x72, 0x20, 0x64, 0x72, 0x61, 0x77, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f,
+    0x74, 0x68, 0x65, 0x72, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x20, 0x6f, 0x76, 0x65, 0x72,
+    0x20, 0x69, 0x74, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x53,
+    0x74, 0x79, 0x6c, 0x65, 0x20, 0x3d, 0x20, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x50, 0x6f, 0x73,
+    0x20, 0x3d, 0x3d, 0x20, 0x75, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x50, 0x6f, 0x73, 0x20, 0x3f,
+    0x20, 0x75, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x53, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x3a, 0x20,
+    0x6b, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x4e, 0x6f, 0x6e, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x43, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x20, 0x3d, 0x20,
+    0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x70, 0x61, 0x6c, 0x65, 0x74,
+    0x74, 0x65, 0x54, 0x65, 0x78, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x75, 0x43, 0x75, 0x72, 0x73,
+    0x6f, 0x72, 0x43, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x73, 0x2e, 0x78, 0x29, 0x2c, 0x20, 0x30, 0x29,
+    0x2e, 0x72, 0x67, 0x62, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x75,
+    0x72, 0x73, 0x6f, 0x72, 0x53, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x3d, 0x3d, 0x20, 0x6b, 0x43, 0x75,
+    0x72, 0x73, 0x6f, 0x72, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20,
+    0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x70, 0x61, 0x6c, 0x65, 0x74,
+    0x74, 0x65, 0x54, 0x65, 0x78, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x75, 0x43, 0x75, 0x72, 0x73,
+    0x6f, 0x72, 0x43, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x73, 0x2e, 0x79, 0x29, 0x2c, 0x20, 0x30, 0x29,
+    0x2e, 0x72, 0x67, 0x62, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61,
+    0x63, 0x6b, 0x20, 0x3d, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x43, 0x6f, 0x6c, 0x6f, 0x75,
+    0x72, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6f,
+    0x72, 0x53, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x3d, 0x20, 0x6b, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72,
+    0x4e, 0x6f, 0x6e, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x61, 0x74, 0x74, 0x72, 0x20, 0x26, 0x20, 0x6b, 0x41, 0x74,
+    0x74, 0x72, 0x49, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x75,
+    0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x76, 0x65, 0x63, 0x33, 0x20, 0x74, 0x20, 0x3d, 0x20, 0x66, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x62, 0x61,
+    0x63, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b,
+    0x20, 0x3d, 0x20, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x2f, 0x2f, 0x20, 0x4c, 0x6f, 0x6f, 0x6b, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79,
+    0x70, 0x68, 0x20, 0x75, 0x70, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x70,
+    0x20, 0x6f, 0x6e, 0x63, 0x65, 0x20, 0x70, 0x65, 0x72, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x20, 0x28,
+    0x73, 0x65, 0x65, 0x20, 0x61, 0x73, 0x63, 0x69, 0x69, 0x2e, 0x66, 0x73, 0x29, 0x2e, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x63,
+    0x65, 0x6c, 0x6c, 0x2e, 0x79, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x3d, 0x3d,
+    0x20, 0x30, 0x75, 0x20, 0x3f, 0x20, 0x75, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x3a, 0x20, 0x69, 0x6e,
+    0x74, 0x28, 0x66, 0x6f, 0x6e, 0x74, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x3d, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x2e, 0x78, 0x20,
+    0x3c, 0x20, 0x36, 0x35, 0x35, 0x33, 0x36, 0x75, 0x20, 0x26, 0x26, 0x20, 0x6c, 0x61, 0x79, 0x65,
+    0x72, 0x20, 0x3c, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x53, 0x69, 0x7a, 0x65, 0x28,
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x4d, 0x61, 0x70, 0x2c, 0x20, 0x30, 0x29, 0x2e, 0x7a, 0x20, 0x3f,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65,
+    0x74, 0x63, 0x68, 0x28, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x4d, 0x61, 0x70, 0x2c, 0x20, 0x69, 0x76,
+    0x65, 0x63, 0x33, 0x28, 0x63, 0x65, 0x6c, 0x6c, 0x2e, 0x78, 0x20, 0x26, 0x20, 0x32, 0x35, 0x35,
+    0x75, 0x2c, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x2e, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x38, 0x2c, 0x20,
+    0x6c, 0x61, 0x79, 0x65, 0x72, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x2e, 0x72, 0x20, 0x3a, 0x20, 0x30,
+    0x75, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x50, 0x6f, 0x73, 0x69, 0x74,
+    0x69, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x71, 0x75, 0x61, 0x64, 0x20, 0x6f, 0x76, 0x65,
+    0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x2c, 0x20, 0x77, 0x69, 0x74, 0x68,
+    0x20, 0x79, 0x20, 0x67, 0x6f, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65,
+    0x63, 0x32, 0x20, 0x63, 0x6f, 0x72, 0x6e, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x76, 0x20, 0x2a, 0x20,
+    0x30, 0x2e, 0x35, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c,
+    0x6f, 0x63, 0x61, 0x6c, 0x20, 0x3d, 0x20, 0x63, 0x6f, 0x72, 0x6e, 0x65, 0x72, 0x20, 0x2a, 0x20,
+    0x75, 0x46, 0x6f, 0x6e, 0x74, 0x52, 0x65, 0x73, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65,
+    0x63, 0x32, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x20, 0x3d, 0x20, 0x28, 0x76, 0x65, 0x63, 0x32,
+    0x28, 0x63, 0x78, 0x2c, 0x20, 0x63, 0x79, 0x29, 0x20, 0x2b, 0x20, 0x63, 0x6f, 0x72, 0x6e, 0x65,
+    0x72, 0x29, 0x20, 0x2a, 0x20, 0x75, 0x46, 0x6f, 0x6e, 0x74, 0x52, 0x65, 0x73, 0x3b, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x6e, 0x64, 0x63, 0x20, 0x3d, 0x20, 0x70, 0x69,
+    0x78, 0x65, 0x6c, 0x20, 0x2f, 0x20, 0x75, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f,
+    0x6e, 0x20, 0x2a, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x2d, 0x20, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x67, 0x6c, 0x5f, 0x50, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d,
+    0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x6e, 0x64, 0x63, 0x2e, 0x78, 0x2c, 0x20, 0x2d, 0x6e, 0x64,
+    0x63, 0x2e, 0x79, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x3b, 0x0a,
+    0x7d, 0x0a, 0x00,
+};
+
+// cells.fs: 1477 bytes
+internal const u8 kAsset3[] =
+{
+    0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x30, 0x30, 0x0a, 0x0a, 0x6f, 0x75,
+    0x74, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x3b, 0x0a, 0x0a,
+    0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x75, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72,
+    0x32, 0x44, 0x41, 0x72, 0x72, 0x61, 0x79, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x54, 0x65, 0x78, 0x3b,
+    0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x47, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x72, 0x6f, 0x77,
+    0x20, 0x6d, 0x61, 0x73, 0x6b, 0x73, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x20, 0x28, 0x79,
+    0x2c, 0x20, 0x67, 0x2c, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x29, 0x20, 0x69, 0x73, 0x20, 0x72, 0x6f,
+    0x77, 0x20, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x67, 0x2c, 0x20,
+    0x62, 0x69, 0x74, 0x20, 0x78, 0x20, 0x73, 0x65, 0x74, 0x20, 0x69, 0x66, 0x20, 0x6c, 0x69, 0x74,
+    0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x75, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65,
+    0x72, 0x32, 0x44, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x54, 0x65, 0x78, 0x3b, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x47, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x63, 0x61,
+    0x63, 0x68, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x20, 0x28, 0x79, 0x2c, 0x20, 0x73,
+    0x6c, 0x6f, 0x74, 0x29, 0x20, 0x69, 0x73, 0x20, 0x72, 0x6f, 0x77, 0x20, 0x79, 0x20, 0x6f, 0x66,
+    0x20, 0x61, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x64, 0x72, 0x61, 0x77, 0x6e, 0x20, 0x74,
+    0x6f, 0x20, 0x66, 0x69, 0x74, 0x20, 0x69, 0x74, 0x73, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x0a, 0x0a,
+    0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x75, 0x46, 0x6f,
+    0x6e, 0x74, 0x52, 0x65, 0x73, 0x3b, 0x0a, 0x0a, 0x2f, 0x2f, 0x20, 0x43, 0x65, 0x6c, 0x6c, 0x20,
+    0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x28,
+    0x73, 0x65, 0x65, 0x20, 0x43, 0x45, 0x4c, 0x4c, 0x5f, 0x41, 0x54, 0x54, 0x52, 0x5f, 0x78, 0x78,
+    0x78, 0x20, 0x69, 0x6e, 0x20, 0x67, 0x61, 0x6d, 0x65, 0x2e, 0x68, 0x29, 0x0a, 0x63, 0x6f, 0x6e,
+    0x73, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6b, 0x41, 0x74, 0x74, 0x72, 0x55, 0x6e, 0x64,
+    0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x3d, 0x20, 0x32, 0x75, 0x3b, 0x0a, 0x0a, 0x2f, 0x2f,
+    0x20, 0x4d, 0x61, 0x70, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x20, 0x75, 0x70, 0x20,
+    0x74, 0x6f, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74,
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x2c, 0x20, 0x61, 0x62, 0x6f, 0x76, 0x65, 0x20, 0x69,
+    0x74, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x73, 0x6c,
+    0x6f, 0x74, 0x73, 0x20, 0x28, 0x73, 0x65, 0x65, 0x20, 0x47, 0x4c, 0x59, 0x50, 0x48, 0x5f, 0x4d,
+    0x41, 0x50, 0x5f, 0x46, 0x4f, 0x4e, 0x54, 0x5f, 0x47, 0x4c, 0x59, 0x50, 0x48, 0x53, 0x20, 0x69,
+    0x6e, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2e, 0x68, 0x29, 0x0a,
+    0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6b, 0x46, 0x6f, 0x6e, 0x74,
+    0x47, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x3d, 0x20, 0x32, 0x35, 0x36, 0x75, 0x3b, 0x0a, 0x0a,
+    0x2f, 0x2f, 0x20, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73,
+    0x20, 0x28, 0x73, 0x65, 0x65, 0x20, 0x43, 0x55, 0x52, 0x53, 0x4f, 0x52, 0x5f, 0x78, 0x78, 0x78,
+    0x20, 0x69, 0x6e, 0x20, 0x67, 0x61, 0x6d, 0x65, 0x2e, 0x68, 0x29, 0x0a, 0x63, 0x6f, 0x6e, 0x73,
+    0x74, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6b, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x55, 0x6e, 0x64,
+    0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x3d, 0x20, 0x32, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73,
+    0x74, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6b, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x42, 0x61, 0x72,
+    0x20, 0x3d, 0x20, 0x33, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x20,
+    0x6b, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x54, 0x68, 0x69, 0x63, 0x6b, 0x6e, 0x65, 0x73, 0x73,
+    0x20, 0x3d, 0x20, 0x32, 0x3b, 0x0a, 0x0a, 0x66, 0x6c, 0x61, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x76,
+    0x65, 0x63, 0x33, 0x20, 0x66, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x66, 0x6c, 0x61, 0x74, 0x20, 0x69,
+    0x6e, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x3b, 0x0a, 0x66, 0x6c, 0x61,
+    0x74, 0x20, 0x69, 0x6e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x3b,
+    0x0a, 0x66, 0x6c, 0x61, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x61, 0x79,
+    0x65, 0x72, 0x3b, 0x0a, 0x66, 0x6c, 0x61, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x75, 0x69, 0x6e, 0x74,
+    0x20, 0x61, 0x74, 0x74, 0x72, 0x3b, 0x0a, 0x66, 0x6c, 0x61, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x69,
+    0x6e, 0x74, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x53, 0x74, 0x79, 0x6c, 0x65, 0x3b, 0x0a,
+    0x66, 0x6c, 0x61, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x63, 0x75, 0x72,
+    0x73, 0x6f, 0x72, 0x43, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x3b, 0x0a, 0x69, 0x6e, 0x20, 0x76, 0x65,
+    0x63, 0x32, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20,
+    0x6d, 0x61, 0x69, 0x6e, 0x28, 0x29, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x76, 0x65,
+    0x63, 0x32, 0x20, 0x70, 0x20, 0x3d, 0x20, 0x69, 0x76, 0x65, 0x63, 0x32, 0x28, 0x6c, 0x6f, 0x63,
+    0x61, 0x6c, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x72,
+    0x6f, 0x77, 0x20, 0x3d, 0x20, 0x30, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+    0x28, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x3e, 0x20, 0x6b, 0x46, 0x6f, 0x6e, 0x74, 0x47, 0x6c,
+    0x79, 0x70, 0x68, 0x73, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x72, 0x6f, 0x77, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x46,
+    0x65, 0x74, 0x63, 0x68, 0x28, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x54, 0x65, 0x78, 0x2c, 0x20, 0x69,
+    0x76, 0x65, 0x63, 0x32, 0x28, 0x70, 0x2e, 0x79, 0x2c, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20,
+    0x2d, 0x20, 0x6b, 0x46, 0x6f, 0x6e, 0x74, 0x47, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x29, 0x2c, 0x20,
+    0x30, 0x29, 0x2e, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x3e,
+    0x20, 0x30, 0x75, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x72, 0x6f, 0x77, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65,
+    0x74, 0x63, 0x68, 0x28, 0x66, 0x6f, 0x6e, 0x74, 0x54, 0x65, 0x78, 0x2c, 0x20, 0x69, 0x76, 0x65,
+    0x63, 0x33, 0x28, 0x70, 0x2e, 0x79, 0x2c, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x2d, 0x20,
+    0x31, 0x75, 0x2c, 0x20, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x2e, 0x72,
+    0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x6f, 0x6c,
+    0x20, 0x6c, 0x69, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x72, 0x6f, 0x77, 0x20, 0x3e, 0x3e, 0x20,
+    0x75, 0x69, 0x6e, 0x74, 0x28, 0x70, 0x2e, 0x78, 0x29, 0x29, 0x20, 0x26, 0x20, 0x31, 0x75, 0x29,
+    0x20, 0x21, 0x3d, 0x20, 0x30, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x6f, 0x6c,
+    0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x61,
+    0x74, 0x74, 0x72, 0x20, 0x26, 0x20, 0x6b, 0x41, 0x74, 0x74, 0x72, 0x55, 0x6e, 0x64, 0x65, 0x72,
+    0x6c, 0x69, 0x6e, 0x65, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x75, 0x29, 0x20, 0x26, 0x26, 0x20,
+    0x28, 0x70, 0x2e, 0x79, 0x20, 0x3d, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x75, 0x46, 0x6f, 0x6e,
+    0x74, 0x52, 0x65, 0x73, 0x2e, 0x79, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x3b, 0x0a, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x20, 0x3d, 0x20, 0x28, 0x6c, 0x69, 0x74,
+    0x20, 0x7c, 0x7c, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x29, 0x20, 0x3f,
+    0x20, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x3a, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x3b, 0x0a, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x53, 0x74,
+    0x79, 0x6c, 0x65, 0x20, 0x3d, 0x3d, 0x20, 0x6b, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x55, 0x6e,
+    0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x26, 0x26, 0x20, 0x70, 0x2e, 0x79, 0x20, 0x3e,
+    0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x75, 0x46, 0x6f, 0x6e, 0x74, 0x52, 0x65, 0x73, 0x2e, 0x79,
+    0x29, 0x20, 0x2d, 0x20, 0x6b, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x54, 0x68, 0x69, 0x63, 0x6b,
+    0x6e, 0x65, 0x73, 0x73, 0x29, 0x20, 0x7c, 0x7c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x28, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x53, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x3d, 0x3d,
+    0x20, 0x6b, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x42, 0x61, 0x72, 0x20, 0x26, 0x26, 0x20, 0x70,
+    0x2e, 0x78, 0x20, 0x3c, 0x20, 0x6b, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x54, 0x68, 0x69, 0x63,
+    0x6b, 0x6e, 0x65, 0x73, 0x73, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x20, 0x3d, 0x20, 0x63,
+    0x75, 0x72, 0x73, 0x6f, 0x72, 0x43, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x7d, 0x0a, 0x7d, 0x0a, 0x00,
+};
+
+// font1.fnt: 8216 bytes
+internal const u8 kAsset4[] =
+{
+    0x46, 0x4f, 0x4e, 0x54, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x02, 0x01,
+    0x4a, 0x01, 0x02, 0x01, 0x32, 0x01, 0x02, 0x01, 0x7a, 0x01, 0x32, 0x01, 0x02, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfe, 0x01,
+    0xb6, 0x01, 0xfe, 0x01, 0xce, 0x01, 0xfe, 0x01, 0x86, 0x01, 0xce, 0x01, 0xfe, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x01,
+    0xfe, 0x03, 0xfe, 0x03, 0xfe, 0x03, 0xfe, 0x03, 0xfc, 0x01, 0xf8, 0x00, 0x70, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x70, 0x00, 0xf8, 0x00, 0xfc, 0x01, 0xfe, 0x03, 0xfc, 0x01, 0xf8, 0x00, 0x70, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x78, 0x00, 0x78, 0x00, 0xce, 0x01, 0xce, 0x01, 0xce, 0x01, 0x30, 0x00, 0x30, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x78, 0x00, 0xfc, 0x00, 0xfe, 0x01, 0xfe, 0x01, 0xfc, 0x00, 0x30, 0x00, 0x30, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x78, 0x00, 0x78, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03,
+    0xff, 0x03, 0xff, 0x03, 0xcf, 0x03, 0x87, 0x03, 0x87, 0x03, 0xcf, 0x03, 0xff, 0x03, 0xff, 0x03,
+    0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x78, 0x00, 0xcc, 0x00, 0x86, 0x01, 0x86, 0x01, 0xcc, 0x00, 0x78, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03,
+    0xff, 0x03, 0x87, 0x03, 0x33, 0x03, 0x79, 0x02, 0x79, 0x02, 0x33, 0x03, 0x87, 0x03, 0xff, 0x03,
+    0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x03, 0xc0, 0x03,
+    0x60, 0x03, 0x30, 0x02, 0xfc, 0x00, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x86, 0x01,
+    0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0xfc, 0x00, 0x30, 0x00, 0xfc, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x03, 0x18, 0x03, 0x18, 0x03,
+    0xf8, 0x03, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x0e, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x8c, 0x01, 0x8c, 0x01,
+    0xfc, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0xcc, 0x01, 0xce, 0x01, 0xce, 0x00, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0xb6, 0x01, 0x78, 0x00, 0xce, 0x01, 0x78, 0x00, 0xb6, 0x01, 0x30, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00, 0x0e, 0x00,
+    0x1e, 0x00, 0x7e, 0x00, 0xfe, 0x01, 0x7e, 0x00, 0x1e, 0x00, 0x0e, 0x00, 0x06, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0xc0, 0x01,
+    0xe0, 0x01, 0xf8, 0x01, 0xfe, 0x01, 0xf8, 0x01, 0xe0, 0x01, 0xc0, 0x01, 0x80, 0x01, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x78, 0x00, 0xfc, 0x00,
+    0xb6, 0x01, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xb6, 0x01, 0xfc, 0x00, 0x78, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01,
+    0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0x00, 0x00, 0x8c, 0x01, 0x8c, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x01, 0xb6, 0x01, 0xb6, 0x01,
+    0xb6, 0x01, 0xb6, 0x01, 0xbc, 0x01, 0xb0, 0x01, 0xb0, 0x01, 0xb0, 0x01, 0xb0, 0x01, 0xb0, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x86, 0x01, 0x0c, 0x00,
+    0x78, 0x00, 0xcc, 0x00, 0x86, 0x01, 0xcc, 0x00, 0x78, 0x00, 0xc0, 0x00, 0x86, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x78, 0x00, 0xfc, 0x00,
+    0xb6, 0x01, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xb6, 0x01, 0xfc, 0x00, 0x78, 0x00, 0xfe, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x78, 0x00, 0xfc, 0x00,
+    0xb6, 0x01, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xb6, 0x01, 0xfc, 0x00, 0x78, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x60, 0x00, 0xc0, 0x00, 0xfe, 0x01, 0xfe, 0x01, 0xc0, 0x00, 0x60, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x18, 0x00, 0x0c, 0x00, 0xfe, 0x01, 0xfe, 0x01, 0x0c, 0x00, 0x18, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0xfe, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x88, 0x00, 0x8c, 0x01, 0xfe, 0x03, 0xfe, 0x03, 0x8c, 0x01, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x70, 0x00,
+    0x70, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xfc, 0x01, 0xfc, 0x01, 0xfe, 0x03, 0xfe, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x03, 0xfe, 0x03,
+    0xfc, 0x01, 0xfc, 0x01, 0xf8, 0x00, 0xf8, 0x00, 0x70, 0x00, 0x70, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xfe, 0x01, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xfe, 0x01, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0x86, 0x01,
+    0x06, 0x01, 0x06, 0x00, 0xfc, 0x00, 0x80, 0x01, 0x82, 0x01, 0x86, 0x01, 0xfc, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0xb6, 0x01, 0xb6, 0x01,
+    0xdc, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0xec, 0x00, 0xb6, 0x01, 0xb6, 0x01, 0xe0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0x78, 0x00, 0xbc, 0x01, 0xe6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0xbc, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x08, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00,
+    0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00,
+    0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0xb6, 0x01,
+    0xfc, 0x00, 0x78, 0x00, 0xfe, 0x01, 0x78, 0x00, 0xfc, 0x00, 0xb6, 0x01, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0xfe, 0x01, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01,
+    0xc0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x86, 0x01, 0x86, 0x01,
+    0xc6, 0x01, 0xe6, 0x01, 0xb6, 0x01, 0x9e, 0x01, 0x8e, 0x01, 0x86, 0x01, 0x86, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x38, 0x00, 0x3c, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x86, 0x01, 0x80, 0x01,
+    0x80, 0x01, 0xc0, 0x00, 0x78, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x86, 0x01, 0xfe, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x86, 0x01, 0x80, 0x01,
+    0x80, 0x01, 0x80, 0x01, 0xf8, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x86, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xe0, 0x00, 0xf0, 0x00,
+    0xd8, 0x00, 0xcc, 0x00, 0xc6, 0x00, 0xfe, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xe0, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0x06, 0x00, 0x06, 0x00,
+    0x06, 0x00, 0x06, 0x00, 0xfe, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x86, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x18, 0x00, 0x0c, 0x00,
+    0x06, 0x00, 0x06, 0x00, 0xfe, 0x00, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0x86, 0x01, 0x80, 0x01,
+    0xc0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x86, 0x01, 0x86, 0x01,
+    0x86, 0x01, 0x86, 0x01, 0xfc, 0x00, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x86, 0x01, 0x86, 0x01,
+    0x86, 0x01, 0x86, 0x01, 0xfc, 0x01, 0x80, 0x01, 0x80, 0x01, 0xc0, 0x00, 0x60, 0x00, 0x3c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x60, 0x00, 0x30, 0x00,
+    0x18, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xc0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x30, 0x00,
+    0x60, 0x00, 0xc0, 0x00, 0x80, 0x01, 0xc0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x86, 0x01, 0x86, 0x01,
+    0x80, 0x01, 0xe0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x86, 0x01, 0xe6, 0x01,
+    0xb6, 0x01, 0xb6, 0x01, 0xb6, 0x01, 0xb6, 0x01, 0xb6, 0x01, 0xe6, 0x00, 0x06, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xcc, 0x00, 0x86, 0x01,
+    0x86, 0x01, 0x86, 0x01, 0xfe, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x8c, 0x01, 0x8c, 0x01,
+    0x8c, 0x01, 0x8c, 0x01, 0xfc, 0x00, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0xfe, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x86, 0x01, 0x06, 0x01,
+    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x01, 0x86, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x8c, 0x01, 0x8c, 0x01,
+    0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0xfe, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0x8c, 0x01, 0x0c, 0x01,
+    0x0c, 0x00, 0x4c, 0x00, 0x7c, 0x00, 0x4c, 0x00, 0x0c, 0x00, 0x0c, 0x01, 0x8c, 0x01, 0xfe, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0x8c, 0x01, 0x0c, 0x01,
+    0x0c, 0x00, 0x4c, 0x00, 0x7c, 0x00, 0x4c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x1e, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x86, 0x01, 0x06, 0x01,
+    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0xe6, 0x01, 0x86, 0x01, 0x86, 0x01, 0xc6, 0x01, 0x7c, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01,
+    0x86, 0x01, 0x86, 0x01, 0xfe, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xc0, 0x00, 0xc0, 0x00,
+    0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0x7c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x01, 0x8c, 0x01, 0xcc, 0x00,
+    0x6c, 0x00, 0x3c, 0x00, 0x1c, 0x00, 0x3c, 0x00, 0x6c, 0x00, 0xcc, 0x00, 0x8c, 0x01, 0x8e, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+    0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x01, 0x8c, 0x01, 0xfe, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x01, 0xce, 0x01, 0xfe, 0x01,
+    0xb6, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x01, 0x8e, 0x01, 0x9e, 0x01,
+    0xb6, 0x01, 0xe6, 0x01, 0xc6, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x86, 0x01, 0x86, 0x01,
+    0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x8c, 0x01, 0x8c, 0x01,
+    0x8c, 0x01, 0x8c, 0x01, 0xfc, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x1e, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x86, 0x01, 0x86, 0x01,
+    0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0xa6, 0x01, 0xe6, 0x01, 0xfc, 0x00,
+    0xc0, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x8c, 0x01, 0x8c, 0x01,
+    0x8c, 0x01, 0x8c, 0x01, 0xfc, 0x00, 0x6c, 0x00, 0xcc, 0x00, 0x8c, 0x01, 0x8c, 0x01, 0x8e, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x86, 0x01, 0x06, 0x01,
+    0x06, 0x00, 0x06, 0x00, 0xfc, 0x00, 0x80, 0x01, 0x80, 0x01, 0x82, 0x01, 0x86, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0xb6, 0x01, 0x32, 0x01,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01,
+    0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01,
+    0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0xcc, 0x00, 0x78, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01,
+    0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0xb6, 0x01, 0xb6, 0x01, 0xfe, 0x01, 0xcc, 0x00, 0xcc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01,
+    0xcc, 0x00, 0x78, 0x00, 0x30, 0x00, 0x78, 0x00, 0xcc, 0x00, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01,
+    0x86, 0x01, 0xcc, 0x00, 0x78, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0x86, 0x01, 0x82, 0x01,
+    0xc0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0c, 0x00, 0x06, 0x01, 0x86, 0x01, 0xfe, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x18, 0x00, 0x18, 0x00,
+    0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00,
+    0x0c, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xc0, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x60, 0x00, 0x60, 0x00,
+    0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x70, 0x00, 0xd8, 0x00, 0x8c, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfe, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x20, 0x00, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0xc0, 0x00, 0xfc, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xbc, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+    0x0c, 0x00, 0x0c, 0x00, 0x7c, 0x00, 0xcc, 0x00, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0xf6, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x8c, 0x01, 0x0c, 0x00, 0x0c, 0x00, 0x8c, 0x01, 0xf8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xc0, 0x00, 0xc0, 0x00,
+    0xc0, 0x00, 0xc0, 0x00, 0xf8, 0x00, 0xcc, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xbc, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x8c, 0x01, 0xfc, 0x01, 0x0c, 0x00, 0x8c, 0x01, 0xf8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xd8, 0x00, 0x98, 0x00,
+    0x18, 0x00, 0x18, 0x00, 0x7c, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x3c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xbc, 0x01, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xfc, 0x00, 0xc0, 0x00,
+    0xc6, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+    0x0c, 0x00, 0x0c, 0x00, 0x7c, 0x00, 0xcc, 0x00, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0x8e, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00,
+    0xc0, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc6, 0x00,
+    0xc6, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+    0x0c, 0x00, 0x0c, 0x00, 0xcc, 0x00, 0x6c, 0x00, 0x3c, 0x00, 0x6c, 0x00, 0xcc, 0x00, 0x8e, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xfe, 0x01, 0xb6, 0x01, 0xb6, 0x01, 0xb6, 0x01, 0xb6, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0xf8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0xfc, 0x00, 0x0c, 0x00,
+    0x0c, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xbc, 0x01, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xfc, 0x00, 0xc0, 0x00,
+    0xc0, 0x00, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x9c, 0x01, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x1e, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x8c, 0x01, 0x38, 0x00, 0xe0, 0x00, 0x8c, 0x01, 0xf8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xb0, 0x01, 0xe0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xbc, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0xcc, 0x00, 0x78, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x86, 0x01, 0x86, 0x01, 0xb6, 0x01, 0xb6, 0x01, 0xfe, 0x01, 0xcc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8c, 0x01, 0xd8, 0x00, 0x70, 0x00, 0x70, 0x00, 0xd8, 0x00, 0x8c, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0xf8, 0x01, 0x80, 0x01,
+    0x8c, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfc, 0x01, 0xcc, 0x00, 0x60, 0x00, 0x30, 0x00, 0x98, 0x01, 0xfc, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x1c, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xe0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0xe0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x1c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x01, 0xf6, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x78, 0x00, 0xcc, 0x00, 0x86, 0x01, 0x86, 0x01, 0xfe, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x86, 0x01, 0x06, 0x01,
+    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x01, 0x86, 0x01, 0xfc, 0x00, 0x60, 0x00,
+    0xcc, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00,
+    0xc6, 0x00, 0x00, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xbc, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x60, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x8c, 0x01, 0xfc, 0x01, 0x0c, 0x00, 0x8c, 0x01, 0xf8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x38, 0x00, 0x6c, 0x00,
+    0xc6, 0x00, 0x00, 0x00, 0x7c, 0x00, 0xc0, 0x00, 0xfc, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xbc, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00,
+    0xc6, 0x00, 0x00, 0x00, 0x7c, 0x00, 0xc0, 0x00, 0xfc, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xbc, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00,
+    0x60, 0x00, 0x00, 0x00, 0x7c, 0x00, 0xc0, 0x00, 0xfc, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xbc, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xcc, 0x00,
+    0x78, 0x00, 0x00, 0x00, 0x7c, 0x00, 0xc0, 0x00, 0xfc, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xbc, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x8c, 0x01, 0x0c, 0x00, 0x8c, 0x01, 0xf8, 0x00, 0x60, 0x00,
+    0xcc, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x70, 0x00, 0xd8, 0x00,
+    0x8c, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x8c, 0x01, 0xfc, 0x01, 0x0c, 0x00, 0x8c, 0x01, 0xf8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x01,
+    0x8c, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x8c, 0x01, 0xfc, 0x01, 0x0c, 0x00, 0x8c, 0x01, 0xf8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00,
+    0x60, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x8c, 0x01, 0xfc, 0x01, 0x0c, 0x00, 0x8c, 0x01, 0xf8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00,
+    0xc6, 0x00, 0x00, 0x00, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x38, 0x00, 0x6c, 0x00,
+    0xc6, 0x00, 0x00, 0x00, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00,
+    0x60, 0x00, 0x00, 0x00, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x01, 0x86, 0x01, 0x00, 0x00,
+    0x78, 0x00, 0xcc, 0x00, 0x86, 0x01, 0x86, 0x01, 0xfe, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xcc, 0x00, 0x78, 0x00, 0x00, 0x00,
+    0x78, 0x00, 0xcc, 0x00, 0x86, 0x01, 0x86, 0x01, 0xfe, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x00, 0x00,
+    0xfe, 0x01, 0x8c, 0x01, 0x0c, 0x00, 0x7c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x8c, 0x01, 0xfe, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xee, 0x00, 0xb8, 0x01, 0xb0, 0x01, 0xfc, 0x00, 0x36, 0x00, 0x76, 0x00, 0xdc, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x6c, 0x00, 0x66, 0x00,
+    0x66, 0x00, 0x66, 0x00, 0xfe, 0x01, 0x66, 0x00, 0x66, 0x00, 0x66, 0x00, 0x66, 0x00, 0xe6, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x70, 0x00, 0xd8, 0x00,
+    0x8c, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0xf8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x01,
+    0x8c, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0xf8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00,
+    0x60, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0xf8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x38, 0x00, 0x6c, 0x00,
+    0xc6, 0x00, 0x00, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xbc, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00,
+    0x60, 0x00, 0x00, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xbc, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x01,
+    0x8c, 0x01, 0x00, 0x00, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0xf8, 0x01, 0x80, 0x01,
+    0x8c, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x01, 0x86, 0x01, 0x00, 0x00,
+    0xfc, 0x00, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x01, 0x86, 0x01, 0x00, 0x00,
+    0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0xfc, 0x00,
+    0x86, 0x01, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x86, 0x01, 0xfc, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xd8, 0x00, 0x98, 0x00,
+    0x18, 0x00, 0x3c, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x9e, 0x01, 0xbb, 0x01, 0xee, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x01,
+    0xcc, 0x00, 0x78, 0x00, 0x30, 0x00, 0xfe, 0x01, 0x30, 0x00, 0xfe, 0x01, 0x30, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0x7c, 0x00, 0x8c, 0x00, 0xcc, 0x00, 0xec, 0x01, 0xcc, 0x00, 0xcc, 0x00, 0x9e, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xb0, 0x01, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x36, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x30, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x7c, 0x00, 0xc0, 0x00, 0xfc, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xbc, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x30, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x60, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0xf8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x30, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xbc, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x01,
+    0xf6, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01, 0x8c, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x01, 0xf6, 0x00, 0x00, 0x00,
+    0x86, 0x01, 0x8e, 0x01, 0x9e, 0x01, 0xb6, 0x01, 0xe6, 0x01, 0xc6, 0x01, 0x86, 0x01, 0x86, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x60, 0x00, 0x7c, 0x00,
+    0x66, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x66, 0x00, 0x66, 0x00,
+    0x66, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x1c, 0x00, 0x06, 0x00, 0x86, 0x01, 0x86, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0e, 0x00, 0x8c, 0x01,
+    0xcc, 0x00, 0x6c, 0x00, 0x30, 0x00, 0x18, 0x00, 0xec, 0x00, 0x86, 0x01, 0xc0, 0x00, 0x60, 0x00,
+    0xf0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0e, 0x00, 0x8c, 0x01,
+    0xcc, 0x00, 0x6c, 0x00, 0x30, 0x00, 0x98, 0x01, 0xcc, 0x01, 0xe6, 0x01, 0xf0, 0x01, 0x80, 0x01,
+    0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x98, 0x01, 0xcc, 0x00, 0x66, 0x00, 0xcc, 0x00, 0x98, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x66, 0x00, 0xcc, 0x00, 0x98, 0x01, 0xcc, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x63, 0x00, 0x9c, 0x03, 0x9c, 0x03,
+    0x63, 0x00, 0x63, 0x00, 0x9c, 0x03, 0x9c, 0x03, 0x63, 0x00, 0x63, 0x00, 0x9c, 0x03, 0x9c, 0x03,
+    0x63, 0x00, 0x63, 0x00, 0x9c, 0x03, 0x9c, 0x03, 0x55, 0x01, 0xaa, 0x02, 0x55, 0x01, 0xaa, 0x02,
+    0x55, 0x01, 0xaa, 0x02, 0x55, 0x01, 0xaa, 0x02, 0x55, 0x01, 0xaa, 0x02, 0x55, 0x01, 0xaa, 0x02,
+    0x55, 0x01, 0xaa, 0x02, 0x55, 0x01, 0xaa, 0x02, 0x63, 0x00, 0x9c, 0x03, 0x63, 0x00, 0x9c, 0x03,
+    0x63, 0x00, 0x9c, 0x03, 0x63, 0x00, 0x9c, 0x03, 0x63, 0x00, 0x9c, 0x03, 0x63, 0x00, 0x9c, 0x03,
+    0x63, 0x00, 0x9c, 0x03, 0x63, 0x00, 0x9c, 0x03, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcf, 0x00, 0xcf, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcf, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xcf, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xcf, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcf, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xf0, 0x03, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xf0, 0x03, 0xf0, 0x03, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xff, 0x03, 0xff, 0x03, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0xf0, 0x03, 0x30, 0x00, 0x30, 0x00, 0xf0, 0x03, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x03, 0xcc, 0x03, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x03, 0x0c, 0x00, 0x0c, 0x00, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfc, 0x03, 0x0c, 0x00, 0x0c, 0x00, 0xcc, 0x03, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcf, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x03, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x03, 0x0c, 0x00, 0x0c, 0x00, 0xcc, 0x03, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcf, 0x03, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x03, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xfc, 0x03, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0xf0, 0x03, 0x30, 0x00, 0x30, 0x00, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x30, 0x00, 0x30, 0x00, 0xf0, 0x03, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x03, 0xfc, 0x03, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xff, 0x03, 0xff, 0x03, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00,
+    0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0xff, 0x03, 0x30, 0x00, 0x30, 0x00, 0xff, 0x03, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x03, 0xf0, 0x03, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03,
+    0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03,
+    0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03,
+    0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00,
+    0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00,
+    0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03,
+    0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03,
+    0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03,
+    0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xbc, 0x01, 0xe6, 0x00, 0x66, 0x00, 0x66, 0x00, 0xe6, 0x00, 0xbc, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf8, 0x00, 0x8c, 0x01, 0x8c, 0x01, 0xfc, 0x00, 0x8c, 0x01, 0x8c, 0x01, 0xfc, 0x00, 0x0c, 0x00,
+    0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00,
+    0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03,
+    0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03,
+    0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03,
+    0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00,
+    0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03,
+    0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03,
+    0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03,
+    0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00,
+    0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
+    0xd8, 0x00, 0x8c, 0x01, 0x8c, 0x01, 0xfe, 0x03, 0x8c, 0x01, 0x8c, 0x01, 0xd8, 0x00, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
+    0xcc, 0x00, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xce, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00,
+    0x0c, 0x00, 0x18, 0x00, 0x30, 0x00, 0x7c, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0x7c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xdc, 0x01, 0x76, 0x03, 0x76, 0x03, 0x76, 0x03, 0xdc, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0xfc, 0x00, 0xb6, 0x01, 0xb6, 0x01, 0xb6, 0x01, 0xfc, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
+    0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x7e, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
+    0xcc, 0x00, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0xfe, 0x01, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0xfe, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+    0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,
+    0x30, 0x00, 0x18, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xb0, 0x01,
+    0xb0, 0x01, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x36, 0x00,
+    0x36, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xbc, 0x01, 0xf6, 0x00, 0x00, 0x00, 0xbc, 0x01, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x66, 0x00, 0x66, 0x00,
+    0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0x60, 0x00, 0x60, 0x00,
+    0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x6e, 0x00, 0x6c, 0x00, 0x78, 0x00,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x66, 0x00, 0x66, 0x00,
+    0x66, 0x00, 0x66, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x36, 0x00, 0x18, 0x00,
+    0x0c, 0x00, 0x26, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// font2.fnt: 6680 bytes
+internal const u8 kAsset5[] =
+{
+    0x46, 0x4f, 0x4e, 0x54, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x0f, 0x0c, 0x08, 0x0c, 0x08, 0x2c, 0x0b, 0x0c, 0x08,
+    0x0c, 0x08, 0xdc, 0x0c, 0xdc, 0x0f, 0xe0, 0x07, 0x80, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xf8, 0x0f, 0xf8, 0x1f, 0xf8, 0x1f, 0x08, 0x18, 0x78, 0x1e, 0x78, 0x1e, 0x78, 0x1e, 0x78, 0x1e,
+    0x70, 0x06, 0x60, 0x06, 0x60, 0x02, 0x00, 0x00, 0x70, 0x1e, 0xf8, 0x1f, 0xfc, 0x1f, 0xfc, 0x1f,
+    0xfc, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf0, 0x1f, 0xe0, 0x0f, 0xc0, 0x07, 0x80, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x81, 0x03, 0xc1, 0x07, 0xe1, 0x0f, 0xf1, 0x1f, 0xf9, 0x1f, 0xf0, 0x1f,
+    0xe0, 0x1f, 0xc0, 0x0f, 0x80, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x80, 0x0f,
+    0x80, 0x0f, 0x80, 0x0f, 0xf0, 0x1f, 0xf9, 0x1f, 0xf9, 0x1f, 0xf0, 0x1f, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x80, 0x0f, 0xc0, 0x1f, 0xe1, 0x1f,
+    0xf3, 0x1f, 0xf3, 0x1f, 0xf1, 0x1f, 0xe0, 0x16, 0x00, 0x06, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc0, 0x1f, 0xc0, 0x1f, 0xc1, 0x1f, 0xc3, 0x1f, 0xc7, 0x1f, 0xc3, 0x1f,
+    0xc1, 0x1f, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf3, 0x1b,
+    0xf3, 0x00, 0xf3, 0x00, 0x73, 0x00, 0xf3, 0x00, 0xf3, 0x00, 0xf3, 0x01, 0xf0, 0x1f, 0xf0, 0x1f,
+    0xf0, 0x1f, 0x0f, 0x00, 0x0f, 0x1f, 0x8f, 0x1f, 0xcf, 0x01, 0xcf, 0x00, 0x6e, 0x00, 0x6e, 0x00,
+    0x6e, 0x00, 0xce, 0x00, 0xcf, 0x00, 0xcf, 0x03, 0x8f, 0x1f, 0x0f, 0x1e, 0xe0, 0x1f, 0xe1, 0x1f,
+    0xe7, 0x01, 0xe6, 0x08, 0x6c, 0x1e, 0x6c, 0x1e, 0x6c, 0x1f, 0x6c, 0x1e, 0x6c, 0x1e, 0xee, 0x1c,
+    0xe7, 0x00, 0xe3, 0x03, 0xe0, 0x1f, 0x1f, 0x00, 0x1f, 0x00, 0x1e, 0x00, 0x18, 0x00, 0x19, 0x0e,
+    0x13, 0x1f, 0x93, 0x11, 0x93, 0x00, 0xdb, 0x00, 0x99, 0x00, 0x9c, 0x11, 0x1f, 0x1f, 0x1f, 0x0e,
+    0x00, 0x00, 0x1e, 0x18, 0x1c, 0x1c, 0x1e, 0x06, 0x17, 0x02, 0x03, 0x02, 0x01, 0x06, 0x03, 0x0e,
+    0x03, 0x1c, 0x03, 0x10, 0x01, 0x1c, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x03, 0x10, 0x07, 0x10,
+    0x0c, 0x10, 0x0c, 0x10, 0x0c, 0x10, 0x0c, 0x10, 0x07, 0x10, 0x03, 0x10, 0x01, 0x10, 0x07, 0x1e,
+    0x01, 0x1e, 0x00, 0x0e, 0x00, 0x00, 0x01, 0x02, 0x01, 0x1e, 0x07, 0x1e, 0x0d, 0x1e, 0x08, 0x1e,
+    0x18, 0x1e, 0x08, 0x1e, 0x00, 0x1e, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x00, 0x3f, 0x00, 0x3f, 0x1c, 0x3f, 0x1c, 0x3f, 0x18, 0x3f, 0x1e, 0x3f, 0x1c, 0x1f, 0x18,
+    0x1f, 0x1c, 0x0f, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+    0x3c, 0x00, 0xfc, 0x00, 0xfc, 0x03, 0xfc, 0x07, 0xfc, 0x01, 0x7c, 0x00, 0x1c, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0f, 0xc0, 0x0f, 0xf0, 0x0f,
+    0xf8, 0x0f, 0xe0, 0x0f, 0x80, 0x0f, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+    0xc0, 0x03, 0xe0, 0x07, 0xb0, 0x07, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xa0, 0x05,
+    0xf0, 0x07, 0xe0, 0x03, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0xe0, 0x07, 0xf8, 0x1f, 0xfc, 0x1f,
+    0xe4, 0x17, 0xa4, 0x14, 0xa4, 0x14, 0xa4, 0x15, 0xe4, 0x17, 0xfc, 0x1f, 0xf0, 0x0f, 0xc0, 0x01,
+    0x00, 0x00, 0x80, 0x1f, 0xc0, 0x1f, 0xf0, 0x1f, 0xd8, 0x1f, 0xd8, 0x1f, 0xc8, 0x1f, 0xd8, 0x1f,
+    0xf0, 0x1f, 0xf0, 0x1f, 0x80, 0x1f, 0x80, 0x1f, 0xc0, 0x1f, 0x00, 0x00, 0x01, 0x00, 0x03, 0x10,
+    0x01, 0x08, 0x61, 0x18, 0x61, 0x18, 0xf1, 0x18, 0x91, 0x08, 0xb1, 0x19, 0xe1, 0x1f, 0x81, 0x16,
+    0x81, 0x1f, 0x01, 0x00, 0x00, 0x00, 0x60, 0x10, 0xf1, 0x19, 0xf1, 0x19, 0xf1, 0x19, 0xf1, 0x19,
+    0xf1, 0x19, 0xf1, 0x19, 0xf1, 0x19, 0xf0, 0x19, 0xf1, 0x19, 0xf0, 0x19, 0xe0, 0x18, 0x00, 0x00,
+    0x01, 0x04, 0x03, 0x0f, 0x83, 0x1f, 0x83, 0x17, 0x03, 0x06, 0x03, 0x06, 0x83, 0x17, 0x83, 0x1f,
+    0x03, 0x0f, 0x03, 0x04, 0x83, 0x1f, 0x83, 0x1f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x1f,
+    0x81, 0x1d, 0x00, 0x0c, 0x00, 0x0c, 0x01, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c,
+    0x01, 0x0c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x01, 0x18, 0x01, 0x18, 0x00, 0x18, 0x00, 0x18,
+    0x00, 0x18, 0x00, 0x18, 0x00, 0x1a, 0x00, 0x1e, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x1f, 0xc0, 0x1f, 0x00, 0x00, 0x02, 0x00,
+    0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03,
+    0x8e, 0x03, 0x8f, 0x1f, 0xdf, 0x1f, 0x8c, 0x01, 0x06, 0x03, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x1f, 0x01, 0x1f, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x00, 0x1f, 0x80, 0x1f, 0x00, 0x03, 0x00, 0x06, 0x00, 0x04,
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x10,
+    0x3f, 0x10, 0x3f, 0x18, 0x18, 0x18, 0x1c, 0x1c, 0x08, 0x1c, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1c, 0x01, 0x1c, 0x03, 0x1c, 0x03, 0x18, 0x07, 0x18, 0x07, 0x10, 0x0f, 0x10,
+    0x0f, 0x00, 0x1f, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00,
+    0xc0, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x80, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0x02, 0x40, 0x02, 0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0c, 0xf8, 0x1f,
+    0xf8, 0x1f, 0x60, 0x0c, 0x60, 0x0c, 0x60, 0x0c, 0xf0, 0x1f, 0xf8, 0x1f, 0x60, 0x0c, 0x20, 0x0c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0x60, 0x1b, 0xb0, 0x17, 0xf0, 0x1f, 0xf0, 0x1f,
+    0x70, 0x1f, 0xf0, 0x1f, 0xb0, 0x1b, 0xe0, 0x1f, 0xc0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0x10, 0xd0, 0x18, 0x91, 0x1c, 0x71, 0x0e, 0x01, 0x07, 0x81, 0x13, 0xc1, 0x09, 0xe0, 0x08,
+    0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0xc1, 0x0c, 0x40, 0x00,
+    0xe0, 0x08, 0xe0, 0x1f, 0x20, 0x08, 0x21, 0x08, 0x61, 0x1c, 0xe1, 0x1f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0x00, 0x0e, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x1c,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x18, 0x00, 0x0e, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1c, 0x00, 0x1c, 0x80, 0x19, 0x81, 0x1f, 0x81, 0x1f, 0x01, 0x1c, 0x01, 0x1e,
+    0x00, 0x17, 0x00, 0x07, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x18,
+    0x04, 0x18, 0x0f, 0x18, 0x8f, 0x1f, 0x01, 0x1f, 0x03, 0x18, 0x07, 0x18, 0x03, 0x18, 0x01, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x18, 0x01, 0x1c, 0x03, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x07, 0x0c, 0x0c, 0x04, 0x0c, 0x44, 0x0c, 0xc4, 0x0c, 0x04, 0x0c, 0x04, 0x0c, 0x0c, 0x0e,
+    0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xf0, 0x00, 0xd0, 0x00,
+    0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x01, 0x70, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x0f, 0x18, 0x18, 0x08, 0x18, 0x00, 0x18, 0xf0, 0x0f, 0x18, 0x00,
+    0x08, 0x00, 0x18, 0x08, 0xf8, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x1f,
+    0x18, 0x18, 0x00, 0x10, 0xe0, 0x1f, 0x00, 0x18, 0x00, 0x10, 0x18, 0x10, 0x38, 0x18, 0xe0, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x80, 0x05, 0xc0, 0x04,
+    0x30, 0x04, 0xf0, 0x1f, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf0, 0x1f, 0x30, 0x00, 0x30, 0x00, 0xf0, 0x1f, 0x00, 0x10, 0x01, 0x00, 0x30, 0x00,
+    0x70, 0x10, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x1f, 0x20, 0x00,
+    0x20, 0x00, 0xe0, 0x1f, 0x61, 0x00, 0x21, 0x00, 0x21, 0x00, 0x61, 0x10, 0xc0, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x1f, 0x60, 0x00, 0x40, 0x10, 0x01, 0x18, 0x03, 0x1c,
+    0x03, 0x0e, 0x03, 0x06, 0x03, 0x06, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc3, 0x1f, 0xc3, 0x00, 0x41, 0x00, 0xc0, 0x1f, 0xc0, 0x00, 0x40, 0x00, 0x40, 0x00, 0xc0, 0x00,
+    0x80, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x1f, 0xc6, 0x00, 0xc6, 0x00,
+    0xc3, 0x1f, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x07, 0x00, 0x81, 0x1f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x06, 0x00, 0x04, 0x00, 0x07, 0x08, 0x06, 0x18, 0x04, 0x00,
+    0x04, 0x00, 0x06, 0x18, 0x03, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x18, 0x00, 0x1c,
+    0x00, 0x0c, 0x00, 0x18, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x03, 0x00, 0x01, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x01, 0x1f,
+    0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x10,
+    0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x10, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x01, 0x06, 0x03, 0x04, 0x06, 0x00, 0x0e, 0x00,
+    0x07, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xcc, 0x0e, 0xfc, 0x0f, 0xfc, 0x0f, 0xbc, 0x0f, 0xbc, 0x0f,
+    0xf0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x1c, 0x0c, 0x0c, 0x08,
+    0x0c, 0x08, 0x0c, 0x0c, 0xfc, 0x0f, 0x0c, 0x08, 0x0c, 0x08, 0x0c, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x03, 0x18, 0x0e, 0x08, 0x0c, 0x18, 0x0c, 0xf8, 0x1f, 0x08, 0x18,
+    0x08, 0x18, 0x08, 0x18, 0xf8, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f,
+    0x38, 0x18, 0x18, 0x10, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x10, 0x18, 0x18, 0xf0, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x30, 0x18, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xe0, 0x1f, 0x30, 0x00, 0x31, 0x00, 0x31, 0x00, 0xf1, 0x0f, 0x31, 0x00, 0x31, 0x00,
+    0x31, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x1f, 0x61, 0x00,
+    0x20, 0x00, 0x60, 0x00, 0xe0, 0x0f, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x21, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x1f, 0xe0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
+    0x60, 0x18, 0x60, 0x00, 0x60, 0x00, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x41, 0x00, 0x43, 0x00, 0x42, 0x00, 0xc0, 0x00, 0xc0, 0x1f, 0x43, 0x00, 0x42, 0x00, 0x43, 0x00,
+    0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x06, 0x1c, 0x06, 0x0c,
+    0x06, 0x0c, 0x07, 0x0c, 0x06, 0x0c, 0x06, 0x0c, 0x06, 0x0c, 0x06, 0x1e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x11, 0x01, 0x1f, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x83, 0x01, 0x81, 0x19, 0x81, 0x1f, 0x81, 0x1f, 0x81, 0x11, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x07, 0x01, 0x01, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x01, 0x01, 0x03, 0x01, 0x06, 0x01, 0x0c, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x13, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x1f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06,
+    0x1c, 0x0e, 0x1e, 0x1e, 0x13, 0x12, 0x10, 0x02, 0x10, 0x02, 0x10, 0x02, 0x10, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x30, 0x0e, 0x30, 0x06, 0x30, 0x06, 0x33, 0x06,
+    0x37, 0x06, 0x3c, 0x06, 0x38, 0x06, 0x30, 0x1c, 0xc0, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xfc, 0x07, 0x04, 0x0c, 0x04, 0x0c, 0xfc, 0x0f, 0x0c, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x0f, 0x0c, 0x0c,
+    0x0c, 0x08, 0x0c, 0x08, 0x0c, 0x08, 0x0c, 0x08, 0x4c, 0x08, 0xfc, 0x0d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x07, 0x08, 0x0c, 0x08, 0x0c, 0xf8, 0x0f, 0xf8, 0x01,
+    0x88, 0x01, 0x08, 0x03, 0x08, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x1f, 0x18, 0x18, 0x18, 0x00, 0xf8, 0x0f, 0x00, 0x18, 0x00, 0x10, 0x18, 0x10, 0x38, 0x18,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x70, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00,
+    0x61, 0x10, 0xc1, 0x10, 0xc1, 0x18, 0x81, 0x19, 0x81, 0x0d, 0x01, 0x0f, 0x01, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x61, 0x00, 0x61, 0x00, 0x60, 0x00,
+    0x60, 0x0e, 0xe0, 0x1b, 0xe0, 0x11, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xc2, 0x00, 0x82, 0x11, 0x02, 0x1b, 0x02, 0x1e, 0x02, 0x0e, 0x03, 0x1f, 0x03, 0x13,
+    0xc3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x01, 0x83, 0x03,
+    0x01, 0x13, 0x00, 0x1e, 0x00, 0x1c, 0x00, 0x0c, 0x01, 0x0c, 0x03, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x1f, 0x03, 0x00, 0x01, 0x10, 0x00, 0x18, 0x00, 0x1c,
+    0x00, 0x0e, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
+    0x0f, 0x1c, 0x06, 0x04, 0x03, 0x04, 0x01, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x0c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x07, 0x00, 0x0e, 0x00, 0x0c,
+    0x00, 0x18, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00,
+    0x06, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x10,
+    0x06, 0x18, 0x06, 0x0e, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf0, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xb0, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x0f, 0x00, 0x08, 0x00, 0x0c, 0xdc, 0x0d, 0x0c, 0x08, 0x08, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0xf8, 0x0f, 0x08, 0x18,
+    0x08, 0x18, 0x08, 0x18, 0x08, 0x18, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x1f, 0x18, 0x10, 0x18, 0x00, 0x18, 0x00, 0x18, 0x10,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10,
+    0xf0, 0x1f, 0x30, 0x10, 0x10, 0x10, 0x10, 0x10, 0x30, 0x10, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0xe1, 0x1f, 0x31, 0x10, 0x31, 0x10,
+    0xb1, 0x0f, 0x31, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0x00, 0x0e, 0x00, 0x06, 0x81, 0x1f, 0x01, 0x06, 0x01, 0x06, 0x00, 0x06, 0x01, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x1f,
+    0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0xc0, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0xc3, 0x1f, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00,
+    0x41, 0x00, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c,
+    0x00, 0x00, 0x03, 0x0f, 0x06, 0x0c, 0x06, 0x0c, 0x06, 0x0c, 0x06, 0x0c, 0x80, 0x1e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x83, 0x01, 0x80, 0x01, 0x83, 0x11, 0x83, 0x1d, 0x83, 0x1f, 0x83, 0x13, 0x83, 0x01,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x10,
+    0x03, 0x10, 0x01, 0x10, 0x00, 0x10, 0x01, 0x10, 0x07, 0x10, 0x08, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x1f, 0x01, 0x13, 0x01, 0x13,
+    0x01, 0x13, 0x01, 0x13, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1f, 0x1e, 0x19, 0x06, 0x11, 0x02, 0x11, 0x02, 0x11, 0x02, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1c,
+    0x30, 0x06, 0x30, 0x06, 0x30, 0x06, 0x30, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x03, 0xac, 0x0e, 0x04, 0x0c, 0x04, 0x0c,
+    0x0c, 0x0c, 0xf8, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf0, 0x03, 0x5c, 0x0d, 0x0c, 0x08, 0x0c, 0x08, 0x0c, 0x0c, 0xf8, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x07, 0x78, 0x1d,
+    0x18, 0x18, 0x18, 0x00, 0x08, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x07, 0x38, 0x18, 0x18, 0x00, 0xf0, 0x0f, 0x00, 0x18,
+    0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01,
+    0xe0, 0x05, 0xa0, 0x05, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xe1, 0x1f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x61, 0x10, 0xc1, 0x10, 0x81, 0x18, 0x81, 0x0d, 0x00, 0x10,
+    0x00, 0x10, 0x80, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x61, 0x06, 0x61, 0x06, 0x60, 0x06, 0x60, 0x06, 0x41, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x82, 0x11, 0x02, 0x1f, 0x02, 0x0e,
+    0x02, 0x1f, 0x06, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0x01, 0x00, 0x00, 0x07,
+    0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x1f, 0x84, 0x12,
+    0x04, 0x10, 0x04, 0x1c, 0x06, 0x06, 0x83, 0x01, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x18, 0x00, 0x18, 0x0f, 0x1c, 0x03, 0x1c, 0x00, 0x18, 0x00, 0x18,
+    0x0e, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x10, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x03, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x18, 0x01, 0x10, 0x01, 0x10, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0x10, 0x01, 0x10, 0x11, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x1c, 0x07, 0x1e, 0x01, 0x07, 0x01, 0x00, 0x30, 0x1c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x1d, 0x18, 0x0f, 0x0c, 0x07, 0x06, 0x00, 0x06, 0xfc, 0x07, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x0f, 0x80, 0x09, 0xc8, 0x0d, 0xf8, 0x0f, 0xfe, 0x03, 0xce, 0x01,
+    0x84, 0x01, 0xf8, 0x0f, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x20, 0x03, 0x00, 0x00, 0x0c, 0x08, 0x0c, 0x08, 0x0c, 0x08, 0x0c, 0x08, 0x08, 0x00, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0x00, 0x00, 0xf8, 0x0f,
+    0x08, 0x18, 0x18, 0x1c, 0xd8, 0x07, 0x38, 0x18, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x03, 0xc0, 0x07, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x10, 0x00, 0x18, 0xb8, 0x1b,
+    0x80, 0x03, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x04,
+    0x00, 0x00, 0xe0, 0x1f, 0x00, 0x10, 0x00, 0x10, 0xf0, 0x17, 0x70, 0x10, 0xc0, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x07, 0x00, 0x00, 0xe0, 0x1f, 0x01, 0x00,
+    0x01, 0x10, 0x71, 0x17, 0x01, 0x0f, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc0, 0x19, 0xc0, 0x19, 0x00, 0x00, 0xc1, 0x1f, 0x01, 0x00, 0x01, 0x00, 0xe1, 0x0f, 0xe0, 0x0e,
+    0x80, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc1, 0x1f, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x83, 0x11, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1f, 0x00, 0x00, 0xc3, 0x1f, 0x42, 0x00, 0xc0, 0x00,
+    0xc0, 0x1e, 0x83, 0x1f, 0x02, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x12, 0x00, 0x00, 0x83, 0x1f, 0xc6, 0x00, 0xc7, 0x00, 0xc1, 0x1e, 0x87, 0x07, 0x84, 0x1c,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x1c, 0x00, 0x00, 0x87, 0x1f,
+    0x86, 0x00, 0x86, 0x01, 0x81, 0x1d, 0x00, 0x18, 0x07, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x00, 0x07, 0x1e, 0x0c, 0x18, 0x0e, 0x18, 0x03, 0x18,
+    0x00, 0x10, 0x03, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x1c,
+    0x00, 0x00, 0x00, 0x1c, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x01, 0x10, 0x00, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0c, 0x03, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x01, 0x10,
+    0x01, 0x10, 0x01, 0x10, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x10,
+    0x00, 0x04, 0x01, 0x06, 0x00, 0x02, 0x01, 0x02, 0x01, 0x06, 0x01, 0x1e, 0x01, 0x02, 0x00, 0x06,
+    0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x0b, 0x18, 0x38, 0x0e, 0x30, 0x06,
+    0x30, 0x06, 0x30, 0x06, 0x3f, 0x1e, 0x30, 0x06, 0xce, 0x01, 0xfe, 0x01, 0x78, 0x00, 0x48, 0x00,
+    0x80, 0x01, 0xe0, 0x01, 0x00, 0x00, 0xfc, 0x0f, 0x04, 0x00, 0x04, 0x00, 0xfc, 0x03, 0x0c, 0x00,
+    0x04, 0x00, 0x0c, 0x0c, 0xf8, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x01,
+    0xd0, 0x05, 0xd0, 0x04, 0xd0, 0x06, 0xf0, 0x03, 0xe0, 0x01, 0xc0, 0x01, 0x08, 0x18, 0xf8, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x18, 0x18,
+    0xf8, 0x1f, 0x18, 0x18, 0x88, 0x18, 0x18, 0x10, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x01, 0xc0, 0x07, 0x40, 0x06, 0x00, 0x00, 0xb8, 0x1b, 0x18, 0x10, 0x18, 0x10,
+    0x30, 0x10, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x04,
+    0xc0, 0x04, 0x00, 0x0b, 0xb0, 0x1b, 0x10, 0x10, 0x10, 0x10, 0x31, 0x00, 0xe1, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x07, 0x40, 0x08, 0x71, 0x13,
+    0x31, 0x00, 0x31, 0x00, 0x61, 0x00, 0xe1, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x80, 0x0f, 0x80, 0x0d, 0x20, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x63, 0x00,
+    0xc3, 0x1f, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e,
+    0x00, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x42, 0x00, 0xc3, 0x1f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00,
+    0x42, 0x00, 0xc6, 0x00, 0x83, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x12,
+    0x00, 0x00, 0x80, 0x1f, 0xc0, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0x84, 0x00, 0x87, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x01, 0x06, 0x00, 0x00, 0x87, 0x00, 0x84, 0x00,
+    0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x0c, 0x18, 0x07, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0x10, 0x00, 0x18, 0x0c, 0x1f, 0x8c, 0x19, 0x8c, 0x19, 0x8c, 0x19, 0x8c, 0x19,
+    0x00, 0x10, 0x03, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x16,
+    0x0f, 0x1e, 0x08, 0x1e, 0x00, 0x07, 0x00, 0x07, 0x08, 0x0e, 0x01, 0x10, 0x07, 0x1c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x0f, 0x0e, 0x07, 0x0c, 0x0e, 0x18,
+    0x1e, 0x1e, 0x06, 0x10, 0x01, 0x02, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x30, 0x06,
+    0x30, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0xfc, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xe0, 0x01, 0x00, 0x00, 0xf8, 0x07, 0x00, 0x0c,
+    0x00, 0x0c, 0xe0, 0x03, 0x20, 0x03, 0x20, 0x03, 0x30, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0xe0, 0x01, 0x00, 0x00, 0xf0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0x08, 0x18, 0x18, 0x18,
+    0xf8, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0x00, 0x00,
+    0xf8, 0x0f, 0x18, 0x18, 0x08, 0x18, 0x18, 0x10, 0x38, 0x18, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x00, 0x00, 0x18, 0x10, 0x18, 0x10, 0x18, 0x10,
+    0x10, 0x10, 0x30, 0x18, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04,
+    0xe0, 0x07, 0x00, 0x00, 0xf0, 0x1f, 0x30, 0x10, 0x10, 0x10, 0x31, 0x00, 0x71, 0x10, 0xc0, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0xc0, 0x07, 0x00, 0x00, 0x30, 0x00, 0xf0, 0x00, 0xf0, 0x01,
+    0x31, 0x03, 0x31, 0x06, 0x21, 0x00, 0x61, 0x10, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x1f, 0x01, 0x18, 0x81, 0x1f, 0xc1, 0x18, 0xc1, 0x19, 0x01, 0x1f, 0x63, 0x00,
+    0xe3, 0x00, 0x81, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x1b,
+    0x80, 0x11, 0x80, 0x11, 0x80, 0x1b, 0x00, 0x0f, 0xc2, 0x00, 0x83, 0x1f, 0x03, 0x00, 0x00, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x1c, 0x01, 0x14, 0x01, 0x04, 0x00, 0x04,
+    0x00, 0x04, 0xc6, 0x00, 0xc7, 0x00, 0xc6, 0x1f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x1f, 0xc0, 0x00, 0xc1, 0x00, 0xc3, 0x00, 0xc2, 0x00, 0xc2, 0x00, 0x84, 0x00, 0x84, 0x00,
+    0x87, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x84, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x19, 0x0c, 0x1f, 0x0f, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+    0x0c, 0x1e, 0x07, 0x1e, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1e, 0x0f, 0x10, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x10, 0x00, 0x18,
+    0x00, 0x1c, 0x00, 0x1e, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x03, 0x00, 0x01, 0x10, 0x01, 0x18, 0x03, 0x1c, 0x07, 0x1e, 0x0f, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x04, 0x1f, 0x1c,
+    0x0f, 0x18, 0x07, 0x10, 0x03, 0x00, 0x03, 0x00, 0xfc, 0x0d, 0x0c, 0x0c, 0xfc, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x09, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x89, 0x04, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x18, 0x18,
+    0xf8, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x1f, 0xfe, 0x1f, 0xff, 0x1f, 0xfc, 0x1f, 0xfe, 0x1f,
+    0xfe, 0x1f, 0xfe, 0x1f, 0xfe, 0x1f, 0x18, 0x10, 0x18, 0x18, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x81, 0x01, 0x81, 0x01, 0x83, 0x01, 0x81, 0x01, 0x81, 0x01, 0x83, 0x01, 0x81, 0x01,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0x31, 0x1c, 0x31, 0x10, 0x31, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0xfc, 0x03, 0xfc, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x18,
+    0xc0, 0x19, 0xc0, 0x19, 0xc0, 0x19, 0xc0, 0x19, 0xc0, 0x19, 0xf8, 0x19, 0xf8, 0x19, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0x1f, 0xf8, 0x1f, 0x00, 0x04, 0x00, 0x04, 0x80, 0x07, 0x80, 0x03,
+    0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x0e,
+    0x01, 0x0c, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x13,
+    0x00, 0x13, 0x80, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07,
+    0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xe3, 0x1f, 0xe3, 0x1f, 0x03, 0x18, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x0e,
+    0x00, 0x0e, 0xc3, 0x0f, 0xc3, 0x0f, 0x07, 0x00, 0x07, 0x00, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e,
+    0x00, 0x1c, 0x00, 0x18, 0x06, 0x00, 0x06, 0x0c, 0x06, 0x0c, 0x06, 0x0c, 0x06, 0x0c, 0x06, 0x0c,
+    0x87, 0x1f, 0xc7, 0x1f, 0x0f, 0x1c, 0x0f, 0x18, 0x0f, 0x10, 0x07, 0x00, 0x01, 0x00, 0x04, 0x00,
+    0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x10, 0x8e, 0x1f, 0x8e, 0x1f, 0x0f, 0x10, 0x0f, 0x00, 0x06, 0x10,
+    0x0f, 0x18, 0x1b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+    0x03, 0x00, 0x03, 0x00, 0x03, 0x1f, 0x83, 0x1f, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x10, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00,
+    0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00,
+    0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x01, 0xff, 0x1f, 0xfe, 0x1f, 0xfe, 0x1f,
+    0xfc, 0x1f, 0xfe, 0x1f, 0xff, 0x1f, 0xfc, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0x1f, 0x81, 0x01, 0x81, 0x01, 0x83, 0x01, 0x81, 0x01, 0x81, 0x01,
+    0x83, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x03, 0x83, 0x1f,
+    0x80, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1f, 0xf8, 0x03, 0xfc, 0x03, 0xf8, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x07, 0xff, 0x1d, 0xc0, 0x19, 0xc0, 0x19, 0xc0, 0x19, 0xc0, 0x19, 0xc0, 0x19, 0xc0, 0x19,
+    0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x07, 0x06, 0xc0, 0x1b,
+    0x80, 0x19, 0x80, 0x19, 0x80, 0x19, 0x80, 0x19, 0x80, 0x19, 0x80, 0x19, 0x80, 0x19, 0x80, 0x19,
+    0x87, 0x19, 0x8f, 0x19, 0x87, 0x19, 0x80, 0x19, 0xf1, 0x0f, 0xf1, 0x0f, 0xf1, 0x0f, 0x01, 0x0c,
+    0x01, 0x0c, 0x01, 0x0c, 0x81, 0x13, 0x81, 0x13, 0x81, 0x13, 0x81, 0x13, 0x81, 0x13, 0x81, 0x13,
+    0x8f, 0x03, 0xe0, 0x13, 0xf0, 0x13, 0xe0, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x01, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x0f, 0x1c, 0x1f, 0x1f, 0x0f, 0x1f, 0x00, 0x07, 0x03, 0x07, 0x03, 0x07,
+    0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xff, 0x07,
+    0xff, 0x07, 0xff, 0x03, 0x00, 0x00, 0xc3, 0x07, 0xe3, 0x07, 0xc3, 0x07, 0x03, 0x06, 0x03, 0x06,
+    0x03, 0x06, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0x00, 0x00,
+    0xc7, 0x1f, 0xc7, 0x1f, 0xc7, 0x1f, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x0e, 0x00, 0x0e,
+    0x00, 0x0e, 0x3f, 0x0e, 0x3f, 0x0e, 0x3f, 0x0e, 0x00, 0x0e, 0x07, 0x00, 0x07, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0xfe, 0x1f, 0xfe, 0x1f,
+    0xfe, 0x1f, 0x00, 0x00, 0x80, 0x1f, 0x80, 0x1f, 0x80, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x0f, 0x00, 0x00, 0x03, 0x00,
+    0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+    0xfc, 0x1f, 0xfc, 0x1f, 0xfc, 0x1f, 0x00, 0x00, 0x80, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03,
+    0xff, 0x1f, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1f, 0xff, 0x1f, 0x01, 0x00, 0xff, 0x1f, 0x80, 0x01,
+    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0xfe, 0x1f, 0x81, 0x1f, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
+    0x80, 0x01, 0xe0, 0x07, 0x60, 0x0e, 0x60, 0x0e, 0x60, 0x0e, 0x60, 0x0e, 0x60, 0x0e, 0xe1, 0x1f,
+    0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x1f, 0x00, 0x1f, 0x03, 0x03, 0xff, 0x1f, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1f,
+    0x07, 0x1f, 0x00, 0x07, 0x07, 0x06, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x80, 0x1f, 0x80, 0x19,
+    0x8f, 0x19, 0x8f, 0x19, 0x80, 0x19, 0x80, 0x19, 0x80, 0x19, 0x80, 0x19, 0x80, 0x19, 0x80, 0x19,
+    0x80, 0x19, 0x80, 0x19, 0x80, 0x19, 0xff, 0x19, 0x8f, 0x0f, 0x01, 0x1f, 0x01, 0x1f, 0x01, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x04, 0x01, 0x0c, 0x01, 0x0c, 0x01, 0x0e, 0xf1, 0x1f, 0xf1, 0x1f,
+    0x0f, 0x00, 0x00, 0x07, 0x1f, 0x13, 0x1f, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x1f,
+    0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x1f, 0x0c, 0x1f, 0x0c, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x1f,
+    0xff, 0x1f, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0xff, 0x07, 0x00, 0x07, 0x00, 0x06,
+    0x00, 0x06, 0x00, 0x0f, 0xc0, 0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0xff, 0x1f,
+    0x00, 0x0e, 0x3f, 0x0e, 0x3f, 0x0e, 0x07, 0x0e, 0x07, 0x0e, 0x07, 0x0e, 0x07, 0x04, 0x3f, 0x00,
+    0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xfe, 0x1f, 0xfe, 0x1f,
+    0x0e, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x80, 0x1f, 0x80, 0x1f, 0x80, 0x1f, 0x80, 0x1f,
+    0x80, 0x1f, 0x80, 0x1f, 0x00, 0x00, 0xff, 0x1f, 0xff, 0x1f, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x1f, 0xfc, 0x1f, 0x1c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x1e, 0x00, 0xfe, 0x1f, 0xfe, 0x1f,
+    0xfe, 0x1f, 0xfe, 0x1f, 0xfe, 0x1f, 0xfe, 0x1f, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0c, 0x78, 0x0e,
+    0xfc, 0x07, 0x01, 0x00, 0xff, 0x1f, 0xff, 0x1f, 0xfe, 0x1f, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00,
+    0x00, 0x00, 0xf0, 0x01, 0x18, 0x03, 0x18, 0x03, 0x98, 0x01, 0x98, 0x01, 0xfe, 0x1f, 0x71, 0x0f,
+    0x71, 0x06, 0x71, 0x06, 0x70, 0x06, 0x70, 0x06, 0x70, 0x06, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x0f,
+    0x18, 0x00, 0x08, 0x00, 0x08, 0x00, 0xe3, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0x18, 0x11, 0x18, 0x10, 0x18, 0x10, 0xf8, 0x1f,
+    0x03, 0x03, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf9, 0x1f, 0xf8, 0x1f, 0x30, 0x00, 0x70, 0x00, 0xe0, 0x00, 0x00, 0x03, 0x03, 0x1f, 0x07, 0x1f,
+    0x03, 0x1f, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x1f, 0xc0, 0x1f, 0xc7, 0x1d, 0xc7, 0x19, 0xc7, 0x19, 0xc0, 0x19, 0xc0, 0x19,
+    0xc0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x07, 0xf0, 0x1f, 0x33, 0x07, 0xff, 0x19,
+    0xc1, 0x19, 0x80, 0x19, 0x80, 0x19, 0x80, 0x19, 0x80, 0x19, 0x80, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0x1f, 0x60, 0x06, 0x03, 0x06, 0x06, 0x06, 0x0f, 0x00, 0xf1, 0x1f, 0xf1, 0x1f, 0xf1, 0x1f,
+    0x01, 0x0c, 0x01, 0x0c, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x80, 0x1f, 0xc0, 0x0d,
+    0xc0, 0x0c, 0xf0, 0x07, 0x1f, 0x00, 0x1f, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x1f, 0xc0, 0x00, 0x41, 0x1f, 0x43, 0x00, 0x46, 0x1f, 0x00, 0x18, 0x00, 0x18,
+    0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0xc7, 0x1e, 0xc4, 0x1c,
+    0x85, 0x1e, 0x84, 0x1f, 0x85, 0x1c, 0xff, 0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0xc0, 0x1f,
+    0xc0, 0x1f, 0xc0, 0x1f, 0x00, 0x00, 0x03, 0x1e, 0x01, 0x17, 0x03, 0x07, 0x0f, 0x1e, 0x0f, 0x1c,
+    0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0x00, 0x00,
+    0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x03, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f,
+    0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x17,
+    0x06, 0x13, 0x0f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1c, 0x19, 0x06, 0x11, 0x02, 0x11, 0x02, 0xfe, 0x00,
+    0x7e, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0x18, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x06, 0xce, 0x03, 0xcc, 0x03, 0xf8, 0x07, 0x70, 0x0e,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x0f,
+    0xf4, 0x05, 0xd8, 0x01, 0x98, 0x03, 0x18, 0x07, 0x18, 0x0c, 0x18, 0x0c, 0xd8, 0x0f, 0x88, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xfc, 0x0f, 0x08, 0x00, 0x08, 0x00,
+    0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x02, 0x00, 0x07, 0x00, 0x1f, 0x18, 0x10, 0x18, 0x11, 0x18, 0x10, 0xf8, 0x1f, 0x18, 0x18,
+    0x18, 0x10, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0xe0, 0x00, 0xf8, 0x00,
+    0xc0, 0x00, 0xc0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x38, 0x00, 0xf8, 0x1f, 0xf8, 0x1f, 0x00, 0x00,
+    0xc0, 0x07, 0xc0, 0x0e, 0x60, 0x0c, 0x60, 0x00, 0x60, 0x00, 0xf8, 0x1f, 0xe0, 0x1f, 0x00, 0x0f,
+    0x80, 0x0f, 0xc0, 0x1f, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x18, 0x00, 0x18,
+    0x00, 0x18, 0x00, 0x18, 0x13, 0x06, 0x91, 0x1f, 0xb0, 0x19, 0x20, 0x00, 0x60, 0x10, 0xe0, 0x1f,
+    0xf0, 0x1f, 0x00, 0x06, 0xf8, 0x19, 0x18, 0x00, 0x88, 0x1f, 0xc8, 0x1f, 0x08, 0x07, 0x06, 0x06,
+    0x06, 0x06, 0x02, 0x06, 0x03, 0x06, 0x01, 0x06, 0x03, 0x0e, 0x03, 0x1c, 0x04, 0x00, 0x0f, 0x00,
+    0x0e, 0x00, 0x0c, 0x00, 0x89, 0x13, 0xc8, 0x1f, 0x40, 0x0c, 0xc0, 0x0c, 0xc0, 0x0c, 0x80, 0x1f,
+    0x00, 0x1f, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1e,
+    0x01, 0x1f, 0x46, 0x1f, 0x46, 0x1f, 0x43, 0x1f, 0x43, 0x1f, 0x40, 0x0e, 0xc0, 0x00, 0x80, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x01, 0x1f, 0x05, 0x1e, 0x05, 0x06,
+    0x05, 0x1f, 0xc5, 0x01, 0xc5, 0x1e, 0xc6, 0x00, 0xc3, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x0e, 0x03, 0x07, 0x07, 0x03, 0x0c, 0x03, 0x1b, 0x07,
+    0x1c, 0x1e, 0x0f, 0x1c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x80, 0x03, 0x80, 0x1f, 0x80, 0x1f,
+    0x87, 0x19, 0x06, 0x1b, 0x04, 0x0e, 0x04, 0x04, 0x06, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x06, 0x1e, 0x0c, 0x06, 0x0f, 0x06, 0x0f, 0x06, 0x19, 0x13, 0x1b, 0x16, 0x0f, 0x1c,
+    0x04, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x10,
+    0x06, 0x18, 0x06, 0x18, 0x19, 0x1e, 0x0d, 0x02, 0x07, 0x02, 0x01, 0x06, 0x01, 0x0e, 0x01, 0x1c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1c, 0x0f, 0x1c, 0x0b, 0x1c, 0x3f, 0x06,
+    0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x20, 0x06, 0x3f, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00,
+};
+
+// font3.fnt: 8216 bytes
+internal const u8 kAsset6[] =
+{
+    0x46, 0x4f, 0x4e, 0x54, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfe, 0x7f, 0xfe, 0x7f,
+    0xe6, 0x67, 0xe6, 0x67, 0xe6, 0x67, 0xfe, 0x7f, 0xfe, 0x7f, 0x1e, 0x78, 0x3e, 0x7c, 0xfe, 0x7f,
+    0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfe, 0x7f, 0xfe, 0x7f,
+    0xfe, 0x7f, 0xfe, 0x7f, 0xc6, 0x63, 0xc0, 0x03, 0xc0, 0x03, 0xde, 0x7b, 0x1e, 0x78, 0x3e, 0x7c,
+    0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1c, 0x7c, 0x3e,
+    0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0x3f, 0xf8, 0x1f, 0xf0, 0x0f, 0xe0, 0x07,
+    0xc0, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xc0, 0x03, 0xe0, 0x07,
+    0xf0, 0x0f, 0xf8, 0x1f, 0xfc, 0x3f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0x3f, 0xf8, 0x1f, 0xf0, 0x0f,
+    0xe0, 0x07, 0xc0, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xe0, 0x07, 0xe0, 0x07,
+    0xe0, 0x07, 0xdc, 0x3b, 0x3e, 0x7c, 0x3e, 0x7c, 0x3e, 0x7c, 0x3e, 0x7c, 0xdc, 0x3b, 0xe0, 0x07,
+    0xe0, 0x07, 0xe0, 0x07, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xc0, 0x03, 0xe0, 0x07,
+    0xf0, 0x0f, 0xf8, 0x1f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xf8, 0x1f, 0xf0, 0x0f,
+    0x80, 0x01, 0xc0, 0x03, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0x07, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xe0, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x1f, 0xf8, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x1f, 0xf8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f,
+    0xf8, 0x1f, 0xf8, 0x1f, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0xf8, 0x1f, 0xf8, 0x1f,
+    0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0x04, 0x20,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f,
+    0x04, 0x20, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x3f,
+    0x00, 0x3c, 0xf0, 0x3f, 0xf8, 0x37, 0xf8, 0x37, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x07,
+    0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xf8, 0x1f, 0x18, 0x18,
+    0x18, 0x18, 0x38, 0x1c, 0x70, 0x0e, 0xe0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0xf0, 0x0f, 0xf0, 0x0f,
+    0xc0, 0x03, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x7f, 0x80, 0x63,
+    0x80, 0x63, 0x80, 0x7f, 0x80, 0x3f, 0x80, 0x03, 0x80, 0x03, 0xe0, 0x03, 0xf0, 0x03, 0xf0, 0x03,
+    0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xf8, 0x1f, 0x78, 0x1e,
+    0x38, 0x1c, 0xf8, 0x1f, 0xf8, 0x1f, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1e, 0x3c, 0x1f,
+    0x3e, 0x1f, 0x3e, 0x0e, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x98, 0x19,
+    0xb8, 0x1d, 0xf0, 0x0f, 0x60, 0x06, 0x3c, 0x3c, 0x3c, 0x3c, 0x60, 0x06, 0xf0, 0x0f, 0xb8, 0x1d,
+    0x98, 0x19, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x3c, 0x00,
+    0xfc, 0x00, 0xfc, 0x03, 0xfc, 0x0f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x0f, 0xfc, 0x03, 0xfc, 0x00,
+    0x3c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x3c,
+    0x00, 0x3f, 0xc0, 0x3f, 0xf0, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xf0, 0x3f, 0xc0, 0x3f, 0x00, 0x3f,
+    0x00, 0x3c, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xc0, 0x03, 0xe0, 0x07,
+    0xf0, 0x0f, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xf0, 0x0f,
+    0xe0, 0x07, 0xc0, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x3f, 0xfc, 0x3f,
+    0xcc, 0x39, 0xcc, 0x39, 0xcc, 0x39, 0xfc, 0x39, 0xf8, 0x39, 0xc0, 0x39, 0xc0, 0x39, 0xc0, 0x39,
+    0xc0, 0x39, 0xc0, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x07, 0xf0, 0x0f, 0x38, 0x1c,
+    0x18, 0x18, 0xd8, 0x17, 0xd8, 0x0f, 0x18, 0x1c, 0x38, 0x18, 0xf0, 0x1b, 0xe8, 0x1b, 0x18, 0x18,
+    0x38, 0x1c, 0xf0, 0x0f, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f,
+    0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xc0, 0x03, 0xe0, 0x07,
+    0xf0, 0x0f, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xf0, 0x0f, 0xe0, 0x07, 0xc0, 0x03,
+    0x80, 0x01, 0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xc0, 0x03, 0xe0, 0x07,
+    0xf0, 0x0f, 0xf8, 0x1f, 0xf8, 0x1f, 0xd8, 0x1b, 0xc8, 0x13, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc8, 0x13, 0xd8, 0x1b, 0xf8, 0x1f, 0xf8, 0x1f, 0xf0, 0x0f,
+    0xe0, 0x07, 0xc0, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07,
+    0x00, 0x0f, 0x00, 0x1e, 0xfe, 0x3f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x3f, 0x00, 0x1e, 0x00, 0x0f,
+    0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01,
+    0xf0, 0x00, 0x78, 0x00, 0xfc, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0x7f, 0x78, 0x00, 0xf0, 0x00,
+    0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0xfc, 0x1f, 0xfc, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x0c, 0x38, 0x1c, 0xfc, 0x3f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0x3f, 0x38, 0x1c, 0x30, 0x0c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01,
+    0xc0, 0x03, 0xc0, 0x03, 0xe0, 0x07, 0xe0, 0x07, 0xf0, 0x0f, 0xf0, 0x0f, 0xf8, 0x1f, 0xf8, 0x1f,
+    0xfc, 0x3f, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfc, 0x3f,
+    0xf8, 0x1f, 0xf8, 0x1f, 0xf0, 0x0f, 0xf0, 0x0f, 0xe0, 0x07, 0xe0, 0x07, 0xc0, 0x03, 0xc0, 0x03,
+    0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xe0, 0x07,
+    0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0xe0, 0x07,
+    0xe0, 0x07, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x1c, 0x30, 0x0c, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1c, 0x38, 0x1c, 0xfe, 0x7f,
+    0xfe, 0x7f, 0xfe, 0x7f, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0xfe, 0x7f, 0xfe, 0x7f,
+    0xfe, 0x7f, 0x38, 0x1c, 0x38, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x60, 0x06, 0x60, 0x06, 0xf8, 0x1f,
+    0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x00, 0xfc, 0x1f, 0xf8, 0x3f, 0x00, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f,
+    0xf8, 0x1f, 0x60, 0x06, 0x60, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x30, 0x3c, 0x38,
+    0x3c, 0x1c, 0x18, 0x0e, 0x00, 0x07, 0x80, 0x03, 0xc0, 0x01, 0xe0, 0x00, 0x70, 0x18, 0x38, 0x3c,
+    0x1c, 0x3c, 0x0c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x07, 0xfc, 0x0f,
+    0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0xf8, 0x27, 0xf8, 0x37, 0x3c, 0x3f, 0x3c, 0x1e, 0x3c, 0x3f,
+    0xfc, 0x3f, 0xf8, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x0f,
+    0xc0, 0x07, 0xe0, 0x03, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xc0, 0x07,
+    0xe0, 0x03, 0xe0, 0x03, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xe0, 0x03, 0xe0, 0x03,
+    0xc0, 0x07, 0x80, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x01, 0xe0, 0x03,
+    0xc0, 0x07, 0xc0, 0x07, 0x80, 0x0f, 0x80, 0x0f, 0x80, 0x0f, 0x80, 0x0f, 0xc0, 0x07, 0xc0, 0x07,
+    0xe0, 0x03, 0xf0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01,
+    0xb0, 0x0d, 0xf0, 0x0f, 0xe0, 0x07, 0xf8, 0x1f, 0xf8, 0x1f, 0xe0, 0x07, 0xf0, 0x0f, 0xb0, 0x0d,
+    0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x0f, 0xc0, 0x07,
+    0xe0, 0x03, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03,
+    0xe0, 0x07, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x3c,
+    0x00, 0x3e, 0x00, 0x1f, 0x80, 0x0f, 0xc0, 0x07, 0xe0, 0x03, 0xf0, 0x01, 0xf8, 0x00, 0x7c, 0x00,
+    0x3c, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x1c, 0x38, 0xdc, 0x3b, 0xdc, 0x3b, 0xdc, 0x3b, 0xdc, 0x3b, 0xdc, 0x3b, 0xdc, 0x3b, 0x1c, 0x38,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xe0, 0x03,
+    0xf0, 0x03, 0xf0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x00, 0x3c, 0x00, 0x1e, 0x80, 0x0f, 0xe0, 0x07, 0xf0, 0x01, 0x78, 0x00, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0xe0, 0x1f, 0xe0, 0x1f, 0x00, 0x3c, 0x00, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x1e, 0x3c, 0x1e,
+    0x3c, 0x1e, 0x3c, 0x1e, 0x3c, 0x1e, 0xfc, 0x3f, 0xfc, 0x3f, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e,
+    0x00, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x1f, 0xfc, 0x1f,
+    0x3c, 0x1e, 0x3c, 0x00, 0x3c, 0x00, 0xfc, 0x0f, 0xfc, 0x1f, 0x00, 0x1e, 0x00, 0x1e, 0x3c, 0x1e,
+    0xfc, 0x1f, 0xf8, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x00, 0x3c, 0x00, 0xfc, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x00, 0x3e, 0x00, 0x1f, 0x80, 0x0f, 0xc0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xf8, 0x1f, 0xf8, 0x1f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xf8, 0x3f, 0x00, 0x3c, 0x00, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03,
+    0xe0, 0x07, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xe0, 0x07,
+    0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03,
+    0xe0, 0x07, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0xc0, 0x07, 0xe0, 0x03,
+    0xf0, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x0f,
+    0xc0, 0x07, 0xe0, 0x03, 0xf0, 0x01, 0xf8, 0x00, 0xf8, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x07,
+    0x80, 0x0f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xf0, 0x01,
+    0xe0, 0x03, 0xc0, 0x07, 0x80, 0x0f, 0x00, 0x1f, 0x00, 0x1f, 0x80, 0x0f, 0xc0, 0x07, 0xe0, 0x03,
+    0xf0, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x07, 0xf0, 0x0f,
+    0x78, 0x1e, 0x30, 0x1e, 0x00, 0x0f, 0x80, 0x07, 0xc0, 0x03, 0x80, 0x01, 0x00, 0x00, 0xc0, 0x03,
+    0xe0, 0x07, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfe, 0x7f, 0x06, 0x60,
+    0x06, 0x60, 0xe6, 0x67, 0xe6, 0x67, 0x66, 0x66, 0x66, 0x66, 0xe6, 0x7f, 0xe6, 0x7f, 0x06, 0x00,
+    0x06, 0x00, 0xfe, 0x7f, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x1f, 0xfe, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x1f, 0xfc, 0x1f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfe, 0x3f, 0xfe, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x1f, 0xfe, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfe, 0x3f, 0xfe, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x3f, 0xfe, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x00, 0x3c, 0x00, 0xfc, 0x07, 0xfc, 0x07, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x3c,
+    0xfe, 0x3f, 0xfe, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x3f, 0xfe, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x00, 0x3c, 0x00, 0xfc, 0x07, 0xfc, 0x07, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+    0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x0f, 0xfc, 0x1f,
+    0x3c, 0x1e, 0x3c, 0x1e, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x1f, 0x3c, 0x1f, 0x3c, 0x1e, 0x3c, 0x1e,
+    0xfc, 0x1f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xf0, 0x0f,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x7e,
+    0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3c, 0x3e, 0x3c,
+    0x3c, 0x3e, 0x3c, 0x1f, 0xfc, 0x0f, 0xfc, 0x07, 0xfc, 0x07, 0xfc, 0x0f, 0x3c, 0x1f, 0x3c, 0x3e,
+    0x3e, 0x3c, 0x3e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x7e, 0x00,
+    0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x3c,
+    0xfe, 0x3f, 0xfe, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x7c, 0x3e,
+    0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xbc, 0x3d, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x7c, 0x3c, 0xfc, 0x3c, 0xfc, 0x3d, 0xfc, 0x3f, 0xfc, 0x3f, 0xbc, 0x3f, 0x3c, 0x3f, 0x3c, 0x3e,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0xfc, 0x3f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x3f,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x1f, 0xfe, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x1f, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+    0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x3f,
+    0xf8, 0x1f, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x1f, 0xfe, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x1f, 0xfc, 0x07, 0xbc, 0x0f, 0x3c, 0x1f, 0x3c, 0x3e,
+    0x3e, 0x3c, 0x3e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0xfc, 0x1f, 0xf8, 0x3f, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfc, 0x3f,
+    0xcc, 0x33, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xe0, 0x07, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x7c, 0x3e, 0xf8, 0x1f, 0xf0, 0x0f,
+    0xe0, 0x07, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xbc, 0x3d, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f,
+    0x78, 0x1e, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x7c, 0x3e, 0xf8, 0x1f, 0xf0, 0x0f, 0xe0, 0x07, 0xe0, 0x07, 0xf0, 0x0f, 0xf8, 0x1f, 0x7c, 0x3e,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x7c, 0x3e, 0xf8, 0x1f, 0xf0, 0x0f, 0xe0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xe0, 0x07, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfc, 0x3f,
+    0x3c, 0x3e, 0x00, 0x1f, 0x80, 0x0f, 0xc0, 0x07, 0xe0, 0x03, 0xf0, 0x01, 0xf8, 0x00, 0x7c, 0x3c,
+    0xfc, 0x3f, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xf0, 0x0f,
+    0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
+    0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3c, 0x00,
+    0x7c, 0x00, 0xf8, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x07, 0x80, 0x0f, 0x00, 0x1f, 0x00, 0x3e,
+    0x00, 0x3c, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xf0, 0x0f,
+    0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f,
+    0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xc0, 0x03, 0xe0, 0x07,
+    0x70, 0x0e, 0x38, 0x1c, 0x18, 0x18, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xfe, 0x7f, 0xfe, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xf0, 0x01,
+    0xe0, 0x03, 0xc0, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x7f, 0xf8, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x3e, 0x00,
+    0x3c, 0x00, 0xfc, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfe, 0x3f, 0xee, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf0, 0x0f, 0xf8, 0x1f, 0x78, 0x1e, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x1e,
+    0xf8, 0x1f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x3e,
+    0x00, 0x3c, 0xf8, 0x3f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x7f, 0xf8, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x1f, 0x3c, 0x00, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0xfe, 0x01, 0xfe, 0x01, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+    0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x77, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xf8, 0x3f, 0x00, 0x3c,
+    0x3c, 0x3c, 0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x3e, 0x00,
+    0x3c, 0x00, 0xfc, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3e, 0x3c, 0x3e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xc0, 0x03,
+    0x00, 0x00, 0xe0, 0x07, 0xe0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x3c,
+    0x00, 0x00, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c,
+    0x78, 0x3c, 0xf8, 0x3f, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x3e, 0x00,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3e, 0x3c, 0x1f, 0xfc, 0x07, 0xfc, 0x0f, 0x3c, 0x1e, 0x3e, 0x3c,
+    0x3e, 0x3c, 0x3e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0xe0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0xbc, 0x3d, 0xbc, 0x3d, 0xbc, 0x3d, 0xbc, 0x3d, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xee, 0x1f, 0xfe, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x1f,
+    0x3c, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x77, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xf8, 0x3f,
+    0x00, 0x3c, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xee, 0x1f, 0xfe, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+    0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x7c, 0x3c, 0xfc, 0x03, 0xf8, 0x1f, 0xc0, 0x3f, 0x3c, 0x3e,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xf0, 0x0f, 0xf0, 0x0f, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x07, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x7c, 0x3e, 0xf8, 0x1f, 0xf0, 0x0f, 0xe0, 0x07,
+    0xc0, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0xbc, 0x3d, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f,
+    0x78, 0x1e, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x78, 0x1e, 0xf0, 0x0f, 0xe0, 0x07, 0xf0, 0x0f, 0x78, 0x1e,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xf8, 0x3f, 0x00, 0x3c,
+    0x3c, 0x3c, 0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xfc, 0x3f, 0xfc, 0x3f, 0x00, 0x1f, 0x80, 0x0f, 0xe0, 0x07, 0xf0, 0x01, 0xf8, 0x00,
+    0xfc, 0x3f, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0xe0, 0x03,
+    0xe0, 0x03, 0xe0, 0x03, 0xf0, 0x01, 0xf8, 0x00, 0xf8, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xe0, 0x03,
+    0xe0, 0x03, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x03, 0xc0, 0x07,
+    0xc0, 0x07, 0xc0, 0x07, 0x80, 0x0f, 0x00, 0x1f, 0x00, 0x1f, 0x80, 0x0f, 0xc0, 0x07, 0xc0, 0x07,
+    0xc0, 0x07, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x78, 0x00, 0xfc, 0x20, 0xfc, 0x3f, 0xfc, 0x3f, 0x84, 0x3f, 0x00, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01,
+    0xc0, 0x03, 0xe0, 0x07, 0x70, 0x0e, 0x38, 0x1c, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x1f, 0xf8, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f,
+    0xf8, 0x1f, 0xc0, 0x03, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x07, 0xc0, 0x03,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x1f, 0x3c, 0x00, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x78, 0x1e, 0x3c, 0x3c,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x7f, 0xf8, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x1e, 0x78, 0x1e, 0x78, 0x1e,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x7f, 0xf8, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07,
+    0x00, 0x00, 0xf0, 0x3f, 0xf8, 0x7f, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+    0xf8, 0xff, 0xf0, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x78, 0x1e, 0x78, 0x1e,
+    0xf0, 0x0f, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x7f, 0xf8, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x3c, 0xfc, 0x3f,
+    0xf8, 0x1f, 0xc0, 0x03, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x78, 0x1e, 0x3c, 0x3c,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x1f, 0x3c, 0x00, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x1e, 0x78, 0x1e, 0x78, 0x1e,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x1f, 0x3c, 0x00, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xe0, 0x01, 0xc0, 0x03,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x1f, 0x3c, 0x00, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x78, 0x1e, 0x3c, 0x3c,
+    0x00, 0x00, 0xe0, 0x07, 0xe0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x1e, 0x78, 0x1e, 0x78, 0x1e,
+    0x00, 0x00, 0xe0, 0x07, 0xe0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xe0, 0x01, 0xc0, 0x03,
+    0x00, 0x00, 0xe0, 0x07, 0xe0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x1e, 0x78, 0x1e, 0x00, 0x00,
+    0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x78, 0x1e, 0x78, 0x1e,
+    0xf0, 0x0f, 0xf8, 0x1f, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0xc0, 0x03, 0x00, 0x00,
+    0xfc, 0x1f, 0xfc, 0x1f, 0x3c, 0x1e, 0x3c, 0x00, 0xfc, 0x01, 0xfc, 0x01, 0x3c, 0x00, 0x3c, 0x1e,
+    0xfc, 0x1f, 0xfc, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x3f, 0xfc, 0x7f, 0x80, 0x73, 0xf8, 0x7f, 0xfc, 0x3f, 0x8c, 0x03, 0x8c, 0x73,
+    0xfc, 0x7f, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0xfe, 0x7f,
+    0x0e, 0x67, 0x0e, 0x07, 0x0e, 0x07, 0xfe, 0x7f, 0xfe, 0x7f, 0x0e, 0x07, 0x0e, 0x07, 0x0e, 0x67,
+    0x0e, 0x7f, 0x0e, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x78, 0x1e, 0x3c, 0x3c,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x1e, 0x78, 0x1e, 0x78, 0x1e,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xe0, 0x01, 0xc0, 0x03,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x78, 0x1e, 0x3c, 0x3c,
+    0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xe0, 0x01, 0xc0, 0x03,
+    0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xf8, 0x3f, 0x00, 0x3c,
+    0x3c, 0x3c, 0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x78, 0x1e, 0x78, 0x1e, 0x00, 0x00, 0xf8, 0x1f,
+    0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x78, 0x3c, 0x78, 0x00, 0x00, 0x3c, 0x78,
+    0x3c, 0x78, 0x3c, 0x78, 0x3c, 0x78, 0x3c, 0x78, 0x3c, 0x78, 0x3c, 0x78, 0x3c, 0x78, 0x3c, 0x78,
+    0xfc, 0x7f, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x06, 0x60, 0x06,
+    0xf0, 0x0f, 0xf8, 0x1f, 0x38, 0x1c, 0x38, 0x00, 0x38, 0x00, 0x38, 0x1c, 0xf8, 0x1f, 0xf0, 0x0f,
+    0x60, 0x06, 0x60, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x1f, 0xf0, 0x3f,
+    0xf0, 0x3c, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x0f, 0xfc, 0x0f, 0xf0, 0x00, 0xf8, 0x00, 0x7c, 0x00,
+    0xfc, 0x3f, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x7c, 0x3e, 0xf8, 0x1f, 0xf0, 0x0f, 0xe0, 0x07, 0xf8, 0x1f, 0xc0, 0x03, 0xf8, 0x1f, 0xc0, 0x03,
+    0xe0, 0x07, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0xfe, 0x03, 0x8e, 0x03,
+    0x8e, 0x03, 0xfe, 0x03, 0xfe, 0x01, 0x0e, 0x02, 0x8e, 0x1f, 0x8e, 0x1f, 0x0e, 0x07, 0x0e, 0x77,
+    0x0e, 0x7f, 0x0e, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1f, 0xc0, 0x3f,
+    0xc0, 0x3b, 0xc0, 0x03, 0xc0, 0x03, 0xf0, 0x0f, 0xf0, 0x0f, 0xc0, 0x03, 0xc0, 0x03, 0xdc, 0x03,
+    0xfc, 0x03, 0xf8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x07, 0xc0, 0x03,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x7f, 0xf8, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x07, 0xc0, 0x03,
+    0x00, 0x00, 0xe0, 0x07, 0xe0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x07, 0xc0, 0x03,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x07, 0xc0, 0x03,
+    0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xf8, 0x11, 0x08, 0x1f, 0x00, 0x0e,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xf8, 0x11, 0x08, 0x1f, 0x00, 0x0e,
+    0x00, 0x00, 0x7c, 0x3c, 0xfc, 0x3c, 0xfc, 0x3d, 0xfc, 0x3f, 0xfc, 0x3f, 0xbc, 0x3f, 0x3c, 0x3f,
+    0x3c, 0x3e, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x07, 0x38, 0x0e, 0x38, 0x0e, 0x38, 0x0e, 0x38, 0x1e, 0xf0, 0x1b, 0x00, 0x00, 0xf8, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x07, 0x38, 0x0e, 0x38, 0x0e, 0x38, 0x0e, 0x38, 0x0e, 0xf0, 0x07, 0x00, 0x00, 0xf8, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xe0, 0x07,
+    0xc0, 0x03, 0x00, 0x00, 0x80, 0x01, 0xc0, 0x03, 0xe0, 0x01, 0xf0, 0x00, 0x78, 0x0c, 0x78, 0x1e,
+    0xf0, 0x0f, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfc, 0x0f, 0xfc, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x30, 0x18, 0x38,
+    0x18, 0x1c, 0x3c, 0x0e, 0x00, 0x07, 0x80, 0x03, 0xc0, 0x01, 0xe0, 0x18, 0x70, 0x24, 0x38, 0x10,
+    0x1c, 0x08, 0x0c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0x98, 0x19, 0xbc, 0x3d,
+    0xbc, 0x3d, 0x98, 0x18, 0x00, 0x00, 0x9f, 0x7d, 0xbe, 0xf9, 0x00, 0x00, 0x18, 0x19, 0xbc, 0x3d,
+    0xbc, 0x3d, 0x98, 0x19, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xe0, 0x07,
+    0xe0, 0x07, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07,
+    0xe0, 0x07, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0x38, 0x70, 0x1c, 0x38, 0x0e, 0x1c, 0x07, 0x1c, 0x07, 0x38, 0x0e, 0x70, 0x1c, 0xe0, 0x38,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x07, 0x38, 0x0e, 0x70, 0x1c, 0xe0, 0x38, 0xe0, 0x38, 0x70, 0x1c, 0x38, 0x0e, 0x1c, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x22, 0x22, 0x44, 0x44, 0x11, 0x11,
+    0x88, 0x88, 0x22, 0x22, 0x44, 0x44, 0x11, 0x11, 0x88, 0x88, 0x22, 0x22, 0x44, 0x44, 0x11, 0x11,
+    0x88, 0x88, 0x22, 0x22, 0x44, 0x44, 0x11, 0x11, 0xaa, 0xaa, 0x99, 0x99, 0x66, 0x66, 0x55, 0x55,
+    0xaa, 0xaa, 0x99, 0x99, 0x66, 0x66, 0x55, 0x55, 0xaa, 0xaa, 0x99, 0x99, 0x66, 0x66, 0x55, 0x55,
+    0xaa, 0xaa, 0x99, 0x99, 0x66, 0x66, 0x55, 0x55, 0xee, 0xee, 0xbb, 0xbb, 0x77, 0x77, 0xdd, 0xdd,
+    0xee, 0xee, 0xbb, 0xbb, 0x77, 0x77, 0xdd, 0xdd, 0xee, 0xee, 0xbb, 0xbb, 0x77, 0x77, 0xdd, 0xdd,
+    0xee, 0xee, 0xbb, 0xbb, 0x77, 0x77, 0xdd, 0xdd, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xff, 0x03, 0xc0, 0x03,
+    0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03,
+    0xc0, 0x03, 0xff, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf7, 0x2f, 0xf7, 0x2f, 0xf7, 0x2f, 0xf7, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xc0, 0x03,
+    0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03,
+    0xc0, 0x03, 0xff, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xf4, 0x2f, 0xf4, 0x2f, 0xf7, 0x2f, 0xf0, 0x2f,
+    0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f,
+    0xf0, 0x2f, 0xf7, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0x00, 0x00, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x20,
+    0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f,
+    0xf0, 0x2f, 0xf7, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf7, 0x2f, 0xf0, 0x2f,
+    0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f,
+    0x00, 0x20, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xff, 0x3f, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0xff, 0x03, 0x80, 0x03,
+    0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03,
+    0x80, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xff, 0xc0, 0x03,
+    0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+    0xc0, 0x03, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0xef, 0xf4, 0xef, 0xf4, 0xef, 0xf4, 0xef, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0xef, 0xf4, 0x0f,
+    0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff,
+    0x04, 0x00, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0x04, 0x00,
+    0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff,
+    0xf4, 0x0f, 0xf4, 0xef, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf7, 0xef, 0xf0, 0x0f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0x0f, 0xf7, 0xef, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0xef, 0xf4, 0x0f,
+    0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff,
+    0xf4, 0x0f, 0xf4, 0xef, 0xf4, 0x2f, 0xf4, 0x2f, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x2f, 0xf4, 0x2f, 0xf7, 0xef, 0xf0, 0x0f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0x0f, 0xf7, 0xef, 0xf4, 0x2f, 0xf4, 0x2f, 0xc0, 0x03, 0xc0, 0x03, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0xff, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xff, 0xc0, 0x03,
+    0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+    0xc0, 0x03, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xc0, 0x03,
+    0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+    0xc0, 0x03, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf7, 0xef, 0xf7, 0xef, 0xf7, 0xef, 0xf7, 0xef, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xc0, 0x03, 0xc0, 0x03, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0xff, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03,
+    0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03,
+    0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x78,
+    0xf8, 0x7d, 0xfc, 0x3f, 0xfe, 0x3f, 0x9e, 0x1f, 0x9e, 0x1f, 0xfe, 0x3f, 0xfc, 0x3f, 0xf8, 0x7d,
+    0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x1e, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f,
+    0xfc, 0x1f, 0x3c, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+    0x3c, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xfc, 0x3f, 0x7c, 0x3e, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x7c, 0x3c, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfc, 0x3f,
+    0x7c, 0x3c, 0xf8, 0x3c, 0xf0, 0x01, 0xe0, 0x03, 0xe0, 0x03, 0xf0, 0x01, 0xf8, 0x3c, 0x7c, 0x3c,
+    0xfc, 0x3f, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x7f, 0xfc, 0x7f, 0x3c, 0x00, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f,
+    0xfc, 0x0f, 0xf8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x7f,
+    0xfc, 0x77, 0x3c, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x7e,
+    0x7e, 0x3f, 0xfe, 0x1f, 0xc2, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01,
+    0xc0, 0x03, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xf8, 0x1f,
+    0xc0, 0x03, 0xe0, 0x07, 0xf0, 0x0f, 0x70, 0x0e, 0x70, 0x0e, 0xf0, 0x0f, 0xe0, 0x07, 0xc0, 0x03,
+    0xf8, 0x1f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfe, 0x7f, 0x1e, 0x78,
+    0x1e, 0x78, 0x1e, 0x78, 0xfe, 0x7f, 0xfe, 0x7f, 0x1e, 0x78, 0x1e, 0x78, 0x1e, 0x78, 0x1e, 0x78,
+    0x1e, 0x78, 0xfe, 0x7f, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfe, 0x7f, 0x1e, 0x78,
+    0x1e, 0x78, 0x1e, 0x78, 0x1e, 0x78, 0x3c, 0x3c, 0x78, 0x1e, 0x78, 0x1e, 0x78, 0x1e, 0x78, 0x1e,
+    0x78, 0x1e, 0x3c, 0x3c, 0x1e, 0x78, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0xe0, 0x0f, 0xe0, 0x00,
+    0xc0, 0x01, 0xc0, 0x03, 0xe0, 0x07, 0xf0, 0x0f, 0x78, 0x1e, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c,
+    0x78, 0x1e, 0xf0, 0x0f, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3e,
+    0xfe, 0x7f, 0x9e, 0x79, 0x9e, 0x79, 0x9e, 0x79, 0x9e, 0x79, 0x9e, 0x79, 0x9e, 0x79, 0xfe, 0x7f,
+    0x7c, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xb8, 0x1f, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0xf8, 0x1f,
+    0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x1f, 0xf8, 0x1f,
+    0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0xf8, 0x1f, 0xf8, 0x1f, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
+    0xf8, 0x1f, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xf8, 0x1f,
+    0xf8, 0x1f, 0x00, 0x00, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0x00, 0x00, 0xf8, 0x1f, 0xf8, 0x1f,
+    0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01,
+    0x80, 0x01, 0xf0, 0x0f, 0xf0, 0x0f, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0xf8, 0x1f,
+    0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xc0, 0x01,
+    0x80, 0x03, 0x00, 0x07, 0x00, 0x07, 0x80, 0x03, 0xc0, 0x01, 0xe0, 0x00, 0x00, 0x00, 0xf8, 0x1f,
+    0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x03,
+    0xc0, 0x01, 0xe0, 0x00, 0xe0, 0x00, 0xc0, 0x01, 0x80, 0x03, 0x00, 0x07, 0x00, 0x00, 0xf8, 0x1f,
+    0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xf8, 0x1f, 0x78, 0x1e,
+    0x78, 0x1e, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00,
+    0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e,
+    0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x78, 0x1e, 0x78, 0x1e,
+    0x78, 0x1e, 0xf8, 0x1f, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xf0, 0x0f, 0xf0,
+    0x0f, 0xf0, 0xff, 0xff, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xff, 0xff, 0x0f, 0xf0,
+    0x0f, 0xf0, 0x0f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xf8, 0x20,
+    0xf8, 0x3f, 0xf8, 0x3f, 0x88, 0x3f, 0x00, 0x1f, 0x78, 0x00, 0xfc, 0x20, 0xfc, 0x3f, 0xfc, 0x3f,
+    0x84, 0x3f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xf8, 0x1f,
+    0x78, 0x1e, 0x78, 0x1e, 0x78, 0x1e, 0xf8, 0x1f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xc0, 0x03, 0xc0, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x40, 0x02, 0x40, 0x02, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7f, 0xc0, 0x7f,
+    0xc0, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xce, 0x00, 0xdc, 0x00, 0xf8, 0x00, 0xf0, 0x00, 0xe0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x07, 0x70, 0x0e,
+    0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0xf0, 0x0f,
+    0x80, 0x07, 0xc0, 0x03, 0xe0, 0x01, 0xf0, 0x0f, 0xf0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// font4.fnt: 8216 bytes
+internal const u8 kAsset7[] =
+{
+    0x46, 0x4f, 0x4e, 0x54, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfe, 0x7f, 0xfe, 0x7f,
+    0xe6, 0x67, 0xe6, 0x67, 0xe6, 0x67, 0xfe, 0x7f, 0xfe, 0x7f, 0x1e, 0x78, 0x3e, 0x7c, 0xfe, 0x7f,
+    0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfe, 0x7f, 0xfe, 0x7f,
+    0xfe, 0x7f, 0xfe, 0x7f, 0xc6, 0x63, 0xc0, 0x03, 0xc0, 0x03, 0xde, 0x7b, 0x1e, 0x78, 0x3e, 0x7c,
+    0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1c, 0x7c, 0x3e,
+    0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0x3f, 0xf8, 0x1f, 0xf0, 0x0f, 0xe0, 0x07,
+    0xc0, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xc0, 0x03, 0xe0, 0x07,
+    0xf0, 0x0f, 0xf8, 0x1f, 0xfc, 0x3f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0x3f, 0xf8, 0x1f, 0xf0, 0x0f,
+    0xe0, 0x07, 0xc0, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xe0, 0x07, 0xe0, 0x07,
+    0xe0, 0x07, 0xdc, 0x3b, 0x3e, 0x7c, 0x3e, 0x7c, 0x3e, 0x7c, 0x3e, 0x7c, 0xdc, 0x3b, 0xe0, 0x07,
+    0xe0, 0x07, 0xe0, 0x07, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xc0, 0x03, 0xe0, 0x07,
+    0xf0, 0x0f, 0xf8, 0x1f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xf8, 0x1f, 0xf0, 0x0f,
+    0x80, 0x01, 0xc0, 0x03, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0x07, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xe0, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x1f, 0xf8, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x1f, 0xf8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f,
+    0xf8, 0x1f, 0xf8, 0x1f, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0xf8, 0x1f, 0xf8, 0x1f,
+    0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0x04, 0x20,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f,
+    0x04, 0x20, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x3f,
+    0x00, 0x3c, 0xf0, 0x3f, 0xf8, 0x37, 0xf8, 0x37, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x07,
+    0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xf8, 0x1f, 0x18, 0x18,
+    0x18, 0x18, 0x38, 0x1c, 0x70, 0x0e, 0xe0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0xf0, 0x0f, 0xf0, 0x0f,
+    0xc0, 0x03, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x7f, 0x80, 0x63,
+    0x80, 0x63, 0x80, 0x7f, 0x80, 0x3f, 0x80, 0x03, 0x80, 0x03, 0xe0, 0x03, 0xf0, 0x03, 0xf0, 0x03,
+    0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xf8, 0x1f, 0x78, 0x1e,
+    0x38, 0x1c, 0xf8, 0x1f, 0xf8, 0x1f, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1e, 0x3c, 0x1f,
+    0x3e, 0x1f, 0x3e, 0x0e, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x98, 0x19,
+    0xb8, 0x1d, 0xf0, 0x0f, 0x60, 0x06, 0x3c, 0x3c, 0x3c, 0x3c, 0x60, 0x06, 0xf0, 0x0f, 0xb8, 0x1d,
+    0x98, 0x19, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x3c, 0x00,
+    0xfc, 0x00, 0xfc, 0x03, 0xfc, 0x0f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x0f, 0xfc, 0x03, 0xfc, 0x00,
+    0x3c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x3c,
+    0x00, 0x3f, 0xc0, 0x3f, 0xf0, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xf0, 0x3f, 0xc0, 0x3f, 0x00, 0x3f,
+    0x00, 0x3c, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xc0, 0x03, 0xe0, 0x07,
+    0xf0, 0x0f, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xf0, 0x0f,
+    0xe0, 0x07, 0xc0, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x3f, 0xfc, 0x3f,
+    0xcc, 0x39, 0xcc, 0x39, 0xcc, 0x39, 0xfc, 0x39, 0xf8, 0x39, 0xc0, 0x39, 0xc0, 0x39, 0xc0, 0x39,
+    0xc0, 0x39, 0xc0, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x07, 0xf0, 0x0f, 0x38, 0x1c,
+    0x18, 0x18, 0xd8, 0x17, 0xd8, 0x0f, 0x18, 0x1c, 0x38, 0x18, 0xf0, 0x1b, 0xe8, 0x1b, 0x18, 0x18,
+    0x38, 0x1c, 0xf0, 0x0f, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f,
+    0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xc0, 0x03, 0xe0, 0x07,
+    0xf0, 0x0f, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xf0, 0x0f, 0xe0, 0x07, 0xc0, 0x03,
+    0x80, 0x01, 0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xc0, 0x03, 0xe0, 0x07,
+    0xf0, 0x0f, 0xf8, 0x1f, 0xf8, 0x1f, 0xd8, 0x1b, 0xc8, 0x13, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc8, 0x13, 0xd8, 0x1b, 0xf8, 0x1f, 0xf8, 0x1f, 0xf0, 0x0f,
+    0xe0, 0x07, 0xc0, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07,
+    0x00, 0x0f, 0x00, 0x1e, 0xfe, 0x3f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x3f, 0x00, 0x1e, 0x00, 0x0f,
+    0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01,
+    0xf0, 0x00, 0x78, 0x00, 0xfc, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0x7f, 0x78, 0x00, 0xf0, 0x00,
+    0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0xfc, 0x1f, 0xfc, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x0c, 0x38, 0x1c, 0xfc, 0x3f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0x3f, 0x38, 0x1c, 0x30, 0x0c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01,
+    0xc0, 0x03, 0xc0, 0x03, 0xe0, 0x07, 0xe0, 0x07, 0xf0, 0x0f, 0xf0, 0x0f, 0xf8, 0x1f, 0xf8, 0x1f,
+    0xfc, 0x3f, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfc, 0x3f,
+    0xf8, 0x1f, 0xf8, 0x1f, 0xf0, 0x0f, 0xf0, 0x0f, 0xe0, 0x07, 0xe0, 0x07, 0xc0, 0x03, 0xc0, 0x03,
+    0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xe0, 0x07,
+    0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0xe0, 0x07,
+    0xe0, 0x07, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x1c, 0x30, 0x0c, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1c, 0x38, 0x1c, 0xfe, 0x7f,
+    0xfe, 0x7f, 0xfe, 0x7f, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0xfe, 0x7f, 0xfe, 0x7f,
+    0xfe, 0x7f, 0x38, 0x1c, 0x38, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x60, 0x06, 0x60, 0x06, 0xf8, 0x1f,
+    0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x00, 0xfc, 0x1f, 0xf8, 0x3f, 0x00, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f,
+    0xf8, 0x1f, 0x60, 0x06, 0x60, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x30, 0x3c, 0x38,
+    0x3c, 0x1c, 0x18, 0x0e, 0x00, 0x07, 0x80, 0x03, 0xc0, 0x01, 0xe0, 0x00, 0x70, 0x18, 0x38, 0x3c,
+    0x1c, 0x3c, 0x0c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x07, 0xfc, 0x0f,
+    0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0xf8, 0x27, 0xf8, 0x37, 0x3c, 0x3f, 0x3c, 0x1e, 0x3c, 0x3f,
+    0xfc, 0x3f, 0xf8, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x0f,
+    0xc0, 0x07, 0xe0, 0x03, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xc0, 0x07,
+    0xe0, 0x03, 0xe0, 0x03, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xe0, 0x03, 0xe0, 0x03,
+    0xc0, 0x07, 0x80, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x01, 0xe0, 0x03,
+    0xc0, 0x07, 0xc0, 0x07, 0x80, 0x0f, 0x80, 0x0f, 0x80, 0x0f, 0x80, 0x0f, 0xc0, 0x07, 0xc0, 0x07,
+    0xe0, 0x03, 0xf0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01,
+    0xb0, 0x0d, 0xf0, 0x0f, 0xe0, 0x07, 0xf8, 0x1f, 0xf8, 0x1f, 0xe0, 0x07, 0xf0, 0x0f, 0xb0, 0x0d,
+    0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x0f, 0xc0, 0x07,
+    0xe0, 0x03, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03,
+    0xe0, 0x07, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x3c,
+    0x00, 0x3e, 0x00, 0x1f, 0x80, 0x0f, 0xc0, 0x07, 0xe0, 0x03, 0xf0, 0x01, 0xf8, 0x00, 0x7c, 0x00,
+    0x3c, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x1c, 0x38, 0xdc, 0x3b, 0xdc, 0x3b, 0xdc, 0x3b, 0xdc, 0x3b, 0xdc, 0x3b, 0xdc, 0x3b, 0x1c, 0x38,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xe0, 0x03,
+    0xf0, 0x03, 0xf0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x00, 0x3c, 0x00, 0x1e, 0x80, 0x0f, 0xe0, 0x07, 0xf0, 0x01, 0x78, 0x00, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0xe0, 0x1f, 0xe0, 0x1f, 0x00, 0x3c, 0x00, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x1e, 0x3c, 0x1e,
+    0x3c, 0x1e, 0x3c, 0x1e, 0x3c, 0x1e, 0xfc, 0x3f, 0xfc, 0x3f, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e,
+    0x00, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x1f, 0xfc, 0x1f,
+    0x3c, 0x1e, 0x3c, 0x00, 0x3c, 0x00, 0xfc, 0x0f, 0xfc, 0x1f, 0x00, 0x1e, 0x00, 0x1e, 0x3c, 0x1e,
+    0xfc, 0x1f, 0xf8, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x00, 0x3c, 0x00, 0xfc, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x00, 0x3e, 0x00, 0x1f, 0x80, 0x0f, 0xc0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xf8, 0x1f, 0xf8, 0x1f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xf8, 0x3f, 0x00, 0x3c, 0x00, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03,
+    0xe0, 0x07, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xe0, 0x07,
+    0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03,
+    0xe0, 0x07, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0xc0, 0x07, 0xe0, 0x03,
+    0xf0, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x0f,
+    0xc0, 0x07, 0xe0, 0x03, 0xf0, 0x01, 0xf8, 0x00, 0xf8, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x07,
+    0x80, 0x0f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xf0, 0x01,
+    0xe0, 0x03, 0xc0, 0x07, 0x80, 0x0f, 0x00, 0x1f, 0x00, 0x1f, 0x80, 0x0f, 0xc0, 0x07, 0xe0, 0x03,
+    0xf0, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x07, 0xf0, 0x0f,
+    0x78, 0x1e, 0x30, 0x1e, 0x00, 0x0f, 0x80, 0x07, 0xc0, 0x03, 0x80, 0x01, 0x00, 0x00, 0xc0, 0x03,
+    0xe0, 0x07, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfe, 0x7f, 0x06, 0x60,
+    0x06, 0x60, 0xe6, 0x67, 0xe6, 0x67, 0x66, 0x66, 0x66, 0x66, 0xe6, 0x7f, 0xe6, 0x7f, 0x06, 0x00,
+    0x06, 0x00, 0xfe, 0x7f, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x1f, 0xfe, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x1f, 0xfc, 0x1f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfe, 0x3f, 0xfe, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x1f, 0xfe, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfe, 0x3f, 0xfe, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x3f, 0xfe, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x00, 0x3c, 0x00, 0xfc, 0x07, 0xfc, 0x07, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x3c,
+    0xfe, 0x3f, 0xfe, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x3f, 0xfe, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x00, 0x3c, 0x00, 0xfc, 0x07, 0xfc, 0x07, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+    0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x0f, 0xfc, 0x1f,
+    0x3c, 0x1e, 0x3c, 0x1e, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x1f, 0x3c, 0x1f, 0x3c, 0x1e, 0x3c, 0x1e,
+    0xfc, 0x1f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xf0, 0x0f,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x7e,
+    0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3c, 0x3e, 0x3c,
+    0x3c, 0x3e, 0x3c, 0x1f, 0xfc, 0x0f, 0xfc, 0x07, 0xfc, 0x07, 0xfc, 0x0f, 0x3c, 0x1f, 0x3c, 0x3e,
+    0x3e, 0x3c, 0x3e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x7e, 0x00,
+    0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x3c,
+    0xfe, 0x3f, 0xfe, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x7c, 0x3e,
+    0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xbc, 0x3d, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x7c, 0x3c, 0xfc, 0x3c, 0xfc, 0x3d, 0xfc, 0x3f, 0xfc, 0x3f, 0xbc, 0x3f, 0x3c, 0x3f, 0x3c, 0x3e,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0xfc, 0x3f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x3f,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x1f, 0xfe, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x1f, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+    0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x3f,
+    0xf8, 0x1f, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x1f, 0xfe, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x1f, 0xfc, 0x07, 0xbc, 0x0f, 0x3c, 0x1f, 0x3c, 0x3e,
+    0x3e, 0x3c, 0x3e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0xfc, 0x1f, 0xf8, 0x3f, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfc, 0x3f,
+    0xcc, 0x33, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xe0, 0x07, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x7c, 0x3e, 0xf8, 0x1f, 0xf0, 0x0f,
+    0xe0, 0x07, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xbc, 0x3d, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f,
+    0x78, 0x1e, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x7c, 0x3e, 0xf8, 0x1f, 0xf0, 0x0f, 0xe0, 0x07, 0xe0, 0x07, 0xf0, 0x0f, 0xf8, 0x1f, 0x7c, 0x3e,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x7c, 0x3e, 0xf8, 0x1f, 0xf0, 0x0f, 0xe0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xe0, 0x07, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfc, 0x3f,
+    0x3c, 0x3e, 0x00, 0x1f, 0x80, 0x0f, 0xc0, 0x07, 0xe0, 0x03, 0xf0, 0x01, 0xf8, 0x00, 0x7c, 0x3c,
+    0xfc, 0x3f, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xf0, 0x0f,
+    0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
+    0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3c, 0x00,
+    0x7c, 0x00, 0xf8, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x07, 0x80, 0x0f, 0x00, 0x1f, 0x00, 0x3e,
+    0x00, 0x3c, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xf0, 0x0f,
+    0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f,
+    0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xc0, 0x03, 0xe0, 0x07,
+    0x70, 0x0e, 0x38, 0x1c, 0x18, 0x18, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xfe, 0x7f, 0xfe, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xf0, 0x01,
+    0xe0, 0x03, 0xc0, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x7f, 0xf8, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x3e, 0x00,
+    0x3c, 0x00, 0xfc, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfe, 0x3f, 0xee, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf0, 0x0f, 0xf8, 0x1f, 0x78, 0x1e, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x1e,
+    0xf8, 0x1f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x3e,
+    0x00, 0x3c, 0xf8, 0x3f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x7f, 0xf8, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x1f, 0x3c, 0x00, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0xfe, 0x01, 0xfe, 0x01, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+    0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x77, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xf8, 0x3f, 0x00, 0x3c,
+    0x3c, 0x3c, 0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x3e, 0x00,
+    0x3c, 0x00, 0xfc, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3e, 0x3c, 0x3e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xc0, 0x03,
+    0x00, 0x00, 0xe0, 0x07, 0xe0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x3c,
+    0x00, 0x00, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c,
+    0x78, 0x3c, 0xf8, 0x3f, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x3e, 0x00,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3e, 0x3c, 0x1f, 0xfc, 0x07, 0xfc, 0x0f, 0x3c, 0x1e, 0x3e, 0x3c,
+    0x3e, 0x3c, 0x3e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0xe0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0xbc, 0x3d, 0xbc, 0x3d, 0xbc, 0x3d, 0xbc, 0x3d, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xee, 0x1f, 0xfe, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x1f,
+    0x3c, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x77, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xf8, 0x3f,
+    0x00, 0x3c, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xee, 0x1f, 0xfe, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+    0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x7c, 0x3c, 0xfc, 0x03, 0xf8, 0x1f, 0xc0, 0x3f, 0x3c, 0x3e,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xf0, 0x0f, 0xf0, 0x0f, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x07, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x7c, 0x3e, 0xf8, 0x1f, 0xf0, 0x0f, 0xe0, 0x07,
+    0xc0, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0xbc, 0x3d, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f,
+    0x78, 0x1e, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x78, 0x1e, 0xf0, 0x0f, 0xe0, 0x07, 0xf0, 0x0f, 0x78, 0x1e,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xf8, 0x3f, 0x00, 0x3c,
+    0x3c, 0x3c, 0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xfc, 0x3f, 0xfc, 0x3f, 0x00, 0x1f, 0x80, 0x0f, 0xe0, 0x07, 0xf0, 0x01, 0xf8, 0x00,
+    0xfc, 0x3f, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0xe0, 0x03,
+    0xe0, 0x03, 0xe0, 0x03, 0xf0, 0x01, 0xf8, 0x00, 0xf8, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xe0, 0x03,
+    0xe0, 0x03, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x03, 0xc0, 0x07,
+    0xc0, 0x07, 0xc0, 0x07, 0x80, 0x0f, 0x00, 0x1f, 0x00, 0x1f, 0x80, 0x0f, 0xc0, 0x07, 0xc0, 0x07,
+    0xc0, 0x07, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x78, 0x00, 0xfc, 0x20, 0xfc, 0x3f, 0xfc, 0x3f, 0x84, 0x3f, 0x00, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01,
+    0xc0, 0x03, 0xe0, 0x07, 0x70, 0x0e, 0x38, 0x1c, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x1f, 0xf8, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f,
+    0xf8, 0x1f, 0xc0, 0x03, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x07, 0xc0, 0x03,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x1f, 0x3c, 0x00, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x78, 0x1e, 0x3c, 0x3c,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x7f, 0xf8, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x1e, 0x78, 0x1e, 0x78, 0x1e,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x7f, 0xf8, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07,
+    0x00, 0x00, 0xf0, 0x3f, 0xf8, 0x7f, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+    0xf8, 0xff, 0xf0, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x78, 0x1e, 0x78, 0x1e,
+    0xf0, 0x0f, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x7f, 0xf8, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x3c, 0xfc, 0x3f,
+    0xf8, 0x1f, 0xc0, 0x03, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x78, 0x1e, 0x3c, 0x3c,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x1f, 0x3c, 0x00, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x1e, 0x78, 0x1e, 0x78, 0x1e,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x1f, 0x3c, 0x00, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xe0, 0x01, 0xc0, 0x03,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x1f, 0x3c, 0x00, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x78, 0x1e, 0x3c, 0x3c,
+    0x00, 0x00, 0xe0, 0x07, 0xe0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x1e, 0x78, 0x1e, 0x78, 0x1e,
+    0x00, 0x00, 0xe0, 0x07, 0xe0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xe0, 0x01, 0xc0, 0x03,
+    0x00, 0x00, 0xe0, 0x07, 0xe0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x1e, 0x78, 0x1e, 0x00, 0x00,
+    0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x78, 0x1e, 0x78, 0x1e,
+    0xf0, 0x0f, 0xf8, 0x1f, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0xc0, 0x03, 0x00, 0x00,
+    0xfc, 0x1f, 0xfc, 0x1f, 0x3c, 0x1e, 0x3c, 0x00, 0xfc, 0x01, 0xfc, 0x01, 0x3c, 0x00, 0x3c, 0x1e,
+    0xfc, 0x1f, 0xfc, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x3f, 0xfc, 0x7f, 0x80, 0x73, 0xf8, 0x7f, 0xfc, 0x3f, 0x8c, 0x03, 0x8c, 0x73,
+    0xfc, 0x7f, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0xfe, 0x7f,
+    0x0e, 0x67, 0x0e, 0x07, 0x0e, 0x07, 0xfe, 0x7f, 0xfe, 0x7f, 0x0e, 0x07, 0x0e, 0x07, 0x0e, 0x67,
+    0x0e, 0x7f, 0x0e, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x78, 0x1e, 0x3c, 0x3c,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x1e, 0x78, 0x1e, 0x78, 0x1e,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xe0, 0x01, 0xc0, 0x03,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x78, 0x1e, 0x3c, 0x3c,
+    0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xe0, 0x01, 0xc0, 0x03,
+    0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f, 0xf8, 0x3f, 0x00, 0x3c,
+    0x3c, 0x3c, 0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x78, 0x1e, 0x78, 0x1e, 0x00, 0x00, 0xf8, 0x1f,
+    0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x78, 0x3c, 0x78, 0x00, 0x00, 0x3c, 0x78,
+    0x3c, 0x78, 0x3c, 0x78, 0x3c, 0x78, 0x3c, 0x78, 0x3c, 0x78, 0x3c, 0x78, 0x3c, 0x78, 0x3c, 0x78,
+    0xfc, 0x7f, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x06, 0x60, 0x06,
+    0xf0, 0x0f, 0xf8, 0x1f, 0x38, 0x1c, 0x38, 0x00, 0x38, 0x00, 0x38, 0x1c, 0xf8, 0x1f, 0xf0, 0x0f,
+    0x60, 0x06, 0x60, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x1f, 0xf0, 0x3f,
+    0xf0, 0x3c, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x0f, 0xfc, 0x0f, 0xf0, 0x00, 0xf8, 0x00, 0x7c, 0x00,
+    0xfc, 0x3f, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x7c, 0x3e, 0xf8, 0x1f, 0xf0, 0x0f, 0xe0, 0x07, 0xf8, 0x1f, 0xc0, 0x03, 0xf8, 0x1f, 0xc0, 0x03,
+    0xe0, 0x07, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0xfe, 0x03, 0x8e, 0x03,
+    0x8e, 0x03, 0xfe, 0x03, 0xfe, 0x01, 0x0e, 0x02, 0x8e, 0x1f, 0x8e, 0x1f, 0x0e, 0x07, 0x0e, 0x77,
+    0x0e, 0x7f, 0x0e, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1f, 0xc0, 0x3f,
+    0xc0, 0x3b, 0xc0, 0x03, 0xc0, 0x03, 0xf0, 0x0f, 0xf0, 0x0f, 0xc0, 0x03, 0xc0, 0x03, 0xdc, 0x03,
+    0xfc, 0x03, 0xf8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x07, 0xc0, 0x03,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x7f, 0xf8, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x07, 0xc0, 0x03,
+    0x00, 0x00, 0xe0, 0x07, 0xe0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x07, 0xc0, 0x03,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x07, 0xc0, 0x03,
+    0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xf8, 0x11, 0x08, 0x1f, 0x00, 0x0e,
+    0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xf8, 0x11, 0x08, 0x1f, 0x00, 0x0e,
+    0x00, 0x00, 0x7c, 0x3c, 0xfc, 0x3c, 0xfc, 0x3d, 0xfc, 0x3f, 0xfc, 0x3f, 0xbc, 0x3f, 0x3c, 0x3f,
+    0x3c, 0x3e, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x07, 0x38, 0x0e, 0x38, 0x0e, 0x38, 0x0e, 0x38, 0x1e, 0xf0, 0x1b, 0x00, 0x00, 0xf8, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x07, 0x38, 0x0e, 0x38, 0x0e, 0x38, 0x0e, 0x38, 0x0e, 0xf0, 0x07, 0x00, 0x00, 0xf8, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xe0, 0x07,
+    0xc0, 0x03, 0x00, 0x00, 0x80, 0x01, 0xc0, 0x03, 0xe0, 0x01, 0xf0, 0x00, 0x78, 0x0c, 0x78, 0x1e,
+    0xf0, 0x0f, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfc, 0x0f, 0xfc, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x30, 0x18, 0x38,
+    0x18, 0x1c, 0x3c, 0x0e, 0x00, 0x07, 0x80, 0x03, 0xc0, 0x01, 0xe0, 0x18, 0x70, 0x24, 0x38, 0x10,
+    0x1c, 0x08, 0x0c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0x98, 0x19, 0xbc, 0x3d,
+    0xbc, 0x3d, 0x98, 0x18, 0x00, 0x00, 0x9f, 0x7d, 0xbe, 0xf9, 0x00, 0x00, 0x18, 0x19, 0xbc, 0x3d,
+    0xbc, 0x3d, 0x98, 0x19, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xe0, 0x07,
+    0xe0, 0x07, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07,
+    0xe0, 0x07, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0x38, 0x70, 0x1c, 0x38, 0x0e, 0x1c, 0x07, 0x1c, 0x07, 0x38, 0x0e, 0x70, 0x1c, 0xe0, 0x38,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x07, 0x38, 0x0e, 0x70, 0x1c, 0xe0, 0x38, 0xe0, 0x38, 0x70, 0x1c, 0x38, 0x0e, 0x1c, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x22, 0x22, 0x44, 0x44, 0x11, 0x11,
+    0x88, 0x88, 0x22, 0x22, 0x44, 0x44, 0x11, 0x11, 0x88, 0x88, 0x22, 0x22, 0x44, 0x44, 0x11, 0x11,
+    0x88, 0x88, 0x22, 0x22, 0x44, 0x44, 0x11, 0x11, 0xaa, 0xaa, 0x99, 0x99, 0x66, 0x66, 0x55, 0x55,
+    0xaa, 0xaa, 0x99, 0x99, 0x66, 0x66, 0x55, 0x55, 0xaa, 0xaa, 0x99, 0x99, 0x66, 0x66, 0x55, 0x55,
+    0xaa, 0xaa, 0x99, 0x99, 0x66, 0x66, 0x55, 0x55, 0xee, 0xee, 0xbb, 0xbb, 0x77, 0x77, 0xdd, 0xdd,
+    0xee, 0xee, 0xbb, 0xbb, 0x77, 0x77, 0xdd, 0xdd, 0xee, 0xee, 0xbb, 0xbb, 0x77, 0x77, 0xdd, 0xdd,
+    0xee, 0xee, 0xbb, 0xbb, 0x77, 0x77, 0xdd, 0xdd, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xff, 0x03, 0xc0, 0x03,
+    0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03,
+    0xc0, 0x03, 0xff, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf7, 0x2f, 0xf7, 0x2f, 0xf7, 0x2f, 0xf7, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xc0, 0x03,
+    0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03,
+    0xc0, 0x03, 0xff, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xf4, 0x2f, 0xf4, 0x2f, 0xf7, 0x2f, 0xf0, 0x2f,
+    0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f,
+    0xf0, 0x2f, 0xf7, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0x00, 0x00, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x20,
+    0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f,
+    0xf0, 0x2f, 0xf7, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf7, 0x2f, 0xf0, 0x2f,
+    0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x2f,
+    0x00, 0x20, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xff, 0x3f, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x03, 0xff, 0x03, 0x80, 0x03,
+    0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03,
+    0x80, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xff, 0xc0, 0x03,
+    0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+    0xc0, 0x03, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0xef, 0xf4, 0xef, 0xf4, 0xef, 0xf4, 0xef, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0xef, 0xf4, 0x0f,
+    0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff,
+    0x04, 0x00, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0x04, 0x00,
+    0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff,
+    0xf4, 0x0f, 0xf4, 0xef, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf7, 0xef, 0xf0, 0x0f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0x0f, 0xf7, 0xef, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0xef, 0xf4, 0x0f,
+    0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff,
+    0xf4, 0x0f, 0xf4, 0xef, 0xf4, 0x2f, 0xf4, 0x2f, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x2f, 0xf4, 0x2f, 0xf7, 0xef, 0xf0, 0x0f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0x0f, 0xf7, 0xef, 0xf4, 0x2f, 0xf4, 0x2f, 0xc0, 0x03, 0xc0, 0x03, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0xff, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xff, 0xc0, 0x03,
+    0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+    0xc0, 0x03, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xc0, 0x03,
+    0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+    0xc0, 0x03, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf7, 0xef, 0xf7, 0xef, 0xf7, 0xef, 0xf7, 0xef, 0xf4, 0x2f, 0xf4, 0x2f,
+    0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xc0, 0x03, 0xc0, 0x03, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0xff, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03,
+    0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03,
+    0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x78,
+    0xf8, 0x7d, 0xfc, 0x3f, 0xfe, 0x3f, 0x9e, 0x1f, 0x9e, 0x1f, 0xfe, 0x3f, 0xfc, 0x3f, 0xf8, 0x7d,
+    0xf0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x1e, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3f,
+    0xfc, 0x1f, 0x3c, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+    0x3c, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xfc, 0x3f, 0xfc, 0x3f, 0x7c, 0x3e, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x7c, 0x3c, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfc, 0x3f,
+    0x7c, 0x3c, 0xf8, 0x3c, 0xf0, 0x01, 0xe0, 0x03, 0xe0, 0x03, 0xf0, 0x01, 0xf8, 0x3c, 0x7c, 0x3c,
+    0xfc, 0x3f, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x7f, 0xfc, 0x7f, 0x3c, 0x00, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f, 0x3c, 0x0f,
+    0xfc, 0x0f, 0xf8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x7f,
+    0xfc, 0x77, 0x3c, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x7e,
+    0x7e, 0x3f, 0xfe, 0x1f, 0xc2, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01,
+    0xc0, 0x03, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xf8, 0x1f,
+    0xc0, 0x03, 0xe0, 0x07, 0xf0, 0x0f, 0x70, 0x0e, 0x70, 0x0e, 0xf0, 0x0f, 0xe0, 0x07, 0xc0, 0x03,
+    0xf8, 0x1f, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfe, 0x7f, 0x1e, 0x78,
+    0x1e, 0x78, 0x1e, 0x78, 0xfe, 0x7f, 0xfe, 0x7f, 0x1e, 0x78, 0x1e, 0x78, 0x1e, 0x78, 0x1e, 0x78,
+    0x1e, 0x78, 0xfe, 0x7f, 0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0xfe, 0x7f, 0x1e, 0x78,
+    0x1e, 0x78, 0x1e, 0x78, 0x1e, 0x78, 0x3c, 0x3c, 0x78, 0x1e, 0x78, 0x1e, 0x78, 0x1e, 0x78, 0x1e,
+    0x78, 0x1e, 0x3c, 0x3c, 0x1e, 0x78, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0xe0, 0x0f, 0xe0, 0x00,
+    0xc0, 0x01, 0xc0, 0x03, 0xe0, 0x07, 0xf0, 0x0f, 0x78, 0x1e, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c,
+    0x78, 0x1e, 0xf0, 0x0f, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x3e,
+    0xfe, 0x7f, 0x9e, 0x79, 0x9e, 0x79, 0x9e, 0x79, 0x9e, 0x79, 0x9e, 0x79, 0x9e, 0x79, 0xfe, 0x7f,
+    0x7c, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xb8, 0x1f, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0x9c, 0x39, 0xf8, 0x1f,
+    0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x1f, 0xf8, 0x1f,
+    0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0xf8, 0x1f, 0xf8, 0x1f, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
+    0xf8, 0x1f, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xfc, 0x3f,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0xf8, 0x1f,
+    0xf8, 0x1f, 0x00, 0x00, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0x00, 0x00, 0xf8, 0x1f, 0xf8, 0x1f,
+    0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01,
+    0x80, 0x01, 0xf0, 0x0f, 0xf0, 0x0f, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0xf8, 0x1f,
+    0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xc0, 0x01,
+    0x80, 0x03, 0x00, 0x07, 0x00, 0x07, 0x80, 0x03, 0xc0, 0x01, 0xe0, 0x00, 0x00, 0x00, 0xf8, 0x1f,
+    0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x03,
+    0xc0, 0x01, 0xe0, 0x00, 0xe0, 0x00, 0xc0, 0x01, 0x80, 0x03, 0x00, 0x07, 0x00, 0x00, 0xf8, 0x1f,
+    0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xf8, 0x1f, 0x78, 0x1e,
+    0x78, 0x1e, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00,
+    0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e,
+    0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x78, 0x1e, 0x78, 0x1e,
+    0x78, 0x1e, 0xf8, 0x1f, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xf0, 0x0f, 0xf0,
+    0x0f, 0xf0, 0xff, 0xff, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xff, 0xff, 0x0f, 0xf0,
+    0x0f, 0xf0, 0x0f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xf8, 0x20,
+    0xf8, 0x3f, 0xf8, 0x3f, 0x88, 0x3f, 0x00, 0x1f, 0x78, 0x00, 0xfc, 0x20, 0xfc, 0x3f, 0xfc, 0x3f,
+    0x84, 0x3f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xf8, 0x1f,
+    0x78, 0x1e, 0x78, 0x1e, 0x78, 0x1e, 0xf8, 0x1f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xc0, 0x03, 0xc0, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x40, 0x02, 0x40, 0x02, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7f, 0xc0, 0x7f,
+    0xc0, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xce, 0x00, 0xdc, 0x00, 0xf8, 0x00, 0xf0, 0x00, 0xe0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x07, 0x70, 0x0e,
+    0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0xf0, 0x0f,
+    0x80, 0x07, 0xc0, 0x03, 0xe0, 0x01, 0xf0, 0x0f, 0xf0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// font5.fnt: 4120 bytes
+internal const u8 kAsset8[] =
+{
+    0x46, 0x4f, 0x4e, 0x54, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x3e, 0x3e, 0x14, 0x14,
+    0x3e, 0x3e, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x08, 0x08, 0x3c, 0x3c, 0x0a, 0x0a, 0x1c, 0x1c,
+    0x28, 0x28, 0x1e, 0x1e, 0x08, 0x08, 0x00, 0x00, 0x06, 0x06, 0x26, 0x26, 0x10, 0x10, 0x08, 0x08,
+    0x04, 0x04, 0x32, 0x32, 0x30, 0x30, 0x00, 0x00, 0x04, 0x04, 0x0a, 0x0a, 0x0a, 0x0a, 0x04, 0x04,
+    0x2a, 0x2a, 0x12, 0x12, 0x2c, 0x2c, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x04, 0x04, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x10, 0x10, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x2a, 0x2a, 0x1c, 0x1c, 0x08, 0x08,
+    0x1c, 0x1c, 0x2a, 0x2a, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x3e, 0x3e,
+    0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x10, 0x10, 0x08, 0x08,
+    0x04, 0x04, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x22, 0x22, 0x32, 0x32, 0x2a, 0x2a,
+    0x26, 0x26, 0x22, 0x22, 0x1c, 0x1c, 0x00, 0x00, 0x08, 0x08, 0x0c, 0x0c, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x1c, 0x1c, 0x00, 0x00, 0x1c, 0x1c, 0x22, 0x22, 0x20, 0x20, 0x18, 0x18,
+    0x04, 0x04, 0x02, 0x02, 0x3e, 0x3e, 0x00, 0x00, 0x3e, 0x3e, 0x20, 0x20, 0x10, 0x10, 0x18, 0x18,
+    0x20, 0x20, 0x22, 0x22, 0x1c, 0x1c, 0x00, 0x00, 0x10, 0x10, 0x18, 0x18, 0x14, 0x14, 0x12, 0x12,
+    0x3e, 0x3e, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x3e, 0x3e, 0x02, 0x02, 0x1e, 0x1e, 0x20, 0x20,
+    0x20, 0x20, 0x22, 0x22, 0x1c, 0x1c, 0x00, 0x00, 0x38, 0x38, 0x04, 0x04, 0x02, 0x02, 0x1e, 0x1e,
+    0x22, 0x22, 0x22, 0x22, 0x1c, 0x1c, 0x00, 0x00, 0x3e, 0x3e, 0x20, 0x20, 0x10, 0x10, 0x08, 0x08,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x1c, 0x1c, 0x22, 0x22, 0x22, 0x22, 0x1c, 0x1c,
+    0x22, 0x22, 0x22, 0x22, 0x1c, 0x1c, 0x00, 0x00, 0x1c, 0x1c, 0x22, 0x22, 0x22, 0x22, 0x3c, 0x3c,
+    0x20, 0x20, 0x10, 0x10, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00,
+    0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x00, 0x00, 0x10, 0x10, 0x08, 0x08, 0x04, 0x04, 0x02, 0x02,
+    0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x00, 0x00,
+    0x3e, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20,
+    0x10, 0x10, 0x08, 0x08, 0x04, 0x04, 0x00, 0x00, 0x1c, 0x1c, 0x22, 0x22, 0x10, 0x10, 0x08, 0x08,
+    0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x1c, 0x1c, 0x22, 0x22, 0x2a, 0x2a, 0x3a, 0x3a,
+    0x1a, 0x1a, 0x02, 0x02, 0x3c, 0x3c, 0x00, 0x00, 0x08, 0x08, 0x14, 0x14, 0x22, 0x22, 0x22, 0x22,
+    0x3e, 0x3e, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x1e, 0x1e, 0x22, 0x22, 0x22, 0x22, 0x1e, 0x1e,
+    0x22, 0x22, 0x22, 0x22, 0x1e, 0x1e, 0x00, 0x00, 0x1c, 0x1c, 0x22, 0x22, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x22, 0x22, 0x1c, 0x1c, 0x00, 0x00, 0x1e, 0x1e, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x1e, 0x1e, 0x00, 0x00, 0x3e, 0x3e, 0x02, 0x02, 0x02, 0x02, 0x1e, 0x1e,
+    0x02, 0x02, 0x02, 0x02, 0x3e, 0x3e, 0x00, 0x00, 0x3e, 0x3e, 0x02, 0x02, 0x02, 0x02, 0x1e, 0x1e,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x3c, 0x3c, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x32, 0x32, 0x22, 0x22, 0x3c, 0x3c, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x3e, 0x3e,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x1c, 0x1c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x1c, 0x1c, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x22, 0x22, 0x1c, 0x1c, 0x00, 0x00, 0x22, 0x22, 0x12, 0x12, 0x0a, 0x0a, 0x06, 0x06,
+    0x0a, 0x0a, 0x12, 0x12, 0x22, 0x22, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x3e, 0x3e, 0x00, 0x00, 0x22, 0x22, 0x36, 0x36, 0x2a, 0x2a, 0x2a, 0x2a,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x26, 0x26, 0x2a, 0x2a,
+    0x32, 0x32, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x1c, 0x1c, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x1c, 0x1c, 0x00, 0x00, 0x1e, 0x1e, 0x22, 0x22, 0x22, 0x22, 0x1e, 0x1e,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x1c, 0x1c, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x2a, 0x2a, 0x12, 0x12, 0x2c, 0x2c, 0x00, 0x00, 0x1e, 0x1e, 0x22, 0x22, 0x22, 0x22, 0x1e, 0x1e,
+    0x0a, 0x0a, 0x12, 0x12, 0x22, 0x22, 0x00, 0x00, 0x1c, 0x1c, 0x22, 0x22, 0x02, 0x02, 0x1c, 0x1c,
+    0x20, 0x20, 0x22, 0x22, 0x1c, 0x1c, 0x00, 0x00, 0x3e, 0x3e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x1c, 0x1c, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x14, 0x14, 0x08, 0x08, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2a, 0x2a,
+    0x2a, 0x2a, 0x36, 0x36, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x14, 0x14, 0x08, 0x08,
+    0x14, 0x14, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x14, 0x14, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x3e, 0x3e, 0x20, 0x20, 0x10, 0x10, 0x08, 0x08,
+    0x04, 0x04, 0x02, 0x02, 0x3e, 0x3e, 0x00, 0x00, 0x3e, 0x3e, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x3e, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x04, 0x04, 0x08, 0x08,
+    0x10, 0x10, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x3e, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x14, 0x14,
+    0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x20, 0x20,
+    0x3c, 0x3c, 0x22, 0x22, 0x3c, 0x3c, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x1e, 0x1e, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x3c, 0x3c, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x3c, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x22, 0x22,
+    0x3e, 0x3e, 0x02, 0x02, 0x3c, 0x3c, 0x00, 0x00, 0x18, 0x18, 0x24, 0x24, 0x04, 0x04, 0x1e, 0x1e,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x22, 0x22,
+    0x22, 0x22, 0x3c, 0x3c, 0x20, 0x20, 0x1c, 0x1c, 0x02, 0x02, 0x02, 0x02, 0x1e, 0x1e, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x0c, 0x0c, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x1c, 0x1c, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x18, 0x18, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x12, 0x12, 0x0c, 0x0c, 0x02, 0x02, 0x02, 0x02, 0x22, 0x22, 0x12, 0x12,
+    0x0e, 0x0e, 0x12, 0x12, 0x22, 0x22, 0x00, 0x00, 0x0c, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x2a, 0x2a,
+    0x2a, 0x2a, 0x2a, 0x2a, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x1e, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x1e, 0x22, 0x22,
+    0x22, 0x22, 0x1e, 0x1e, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x22, 0x22,
+    0x22, 0x22, 0x3c, 0x3c, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x3a, 0x06, 0x06,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x02, 0x02,
+    0x1c, 0x1c, 0x20, 0x20, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x1e, 0x1e, 0x04, 0x04,
+    0x04, 0x04, 0x24, 0x24, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x32, 0x32, 0x2c, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x14, 0x14, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22,
+    0x2a, 0x2a, 0x2a, 0x2a, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x14, 0x14,
+    0x08, 0x08, 0x14, 0x14, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x3c, 0x3c, 0x20, 0x20, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x10, 0x10,
+    0x08, 0x08, 0x04, 0x04, 0x3e, 0x3e, 0x00, 0x00, 0x38, 0x38, 0x0c, 0x0c, 0x0c, 0x0c, 0x06, 0x06,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x38, 0x38, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0e, 0x0e, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30,
+    0x18, 0x18, 0x18, 0x18, 0x0e, 0x0e, 0x00, 0x00, 0x2c, 0x2c, 0x1a, 0x1a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0x14, 0x14, 0x2a, 0x2a,
+    0x14, 0x14, 0x2a, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const EmbeddedAsset gEmbeddedAssets[] =
+{
+    { "ascii.vs", kAsset0, sizeof(kAsset0) - 1 },
+    { "ascii.fs", kAsset1, sizeof(kAsset1) - 1 },
+    { "cells.vs", kAsset2, sizeof(kAsset2) - 1 },
+    { "cells.fs", kAsset3, sizeof(kAsset3) - 1 },
+    { "font1.fnt", kAsset4, sizeof(kAsset4) - 1 },
+    { "font2.fnt", kAsset5, sizeof(kAsset5) - 1 },
+    { "font3.fnt", kAsset6, sizeof(kAsset6) - 1 },
+    { "font4.fnt", kAsset7, sizeof(kAsset7) - 1 },
+    { "font5.fnt", kAsset8, sizeof(kAsset8) - 1 },
+};
+
+const int gNumEmbeddedAssets = 9;
@@ -0,0 +1,163 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       fontatlas.c
+//! @brief      1-bit font atlases and their precompiled file format.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <fontatlas.h>
+
+#include <stdio.h>
+#include <string.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+
+i64 fontAtlasBitsSize(const FontAtlas* atlas)
+{
+    return (i64)atlas->numGlyphs * atlas->glyphHeight * atlas->rowBytes;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+bool fontAtlasLoad(FontAtlas* atlas, const u8* bytes, i64 size)
+{
+    memoryClear(atlas, sizeof(*atlas));
+
+    FontFileHeader header;
+    bool valid = size >= (i64)sizeof(header);
+    if (valid)
+    {
+        memcpy(&header, bytes, sizeof(header));
+        valid =
+            header.magic == FONT_FILE_MAGIC &&
+            header.version == FONT_FILE_VERSION &&
+            header.glyphWidth > 0 && header.glyphWidth <= 256 &&
+            header.glyphHeight > 0 && header.glyphHeight <= 256 &&
+            header.numGlyphs > 0 && header.numGlyphs <= 65536 &&
+            header.rowBytes == (header.glyphWidth + 7) / 8;
+    }
+    if (valid)
+    {
+        atlas->glyphWidth = (int)header.glyphWidth;
+        atlas->glyphHeight = (int)header.glyphHeight;
+        atlas->numGlyphs = (int)header.numGlyphs;
+        atlas->rowBytes = (int)header.rowBytes;
+        atlas->bits = bytes + sizeof(header);
+        valid = size >= (i64)sizeof(header) + fontAtlasBitsSize(atlas);
+    }
+
+    if (!valid) fontAtlasDone(atlas);
+    return valid;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+STRUCT_START(Cp437Glyph)
+{
+    u16     codepoint;
+    u8      glyph;
+}
+STRUCT_END(Cp437Glyph);
+
+// Codepoints of the code page 437 glyphs outside printable ASCII, sorted by codepoint for a binary search.
+internal const Cp437Glyph kCp437[] =
+{
+    { 0x00a0, 255 }, { 0x00a1, 173 }, { 0x00a2, 155 }, { 0x00a3, 156 }, { 0x00a5, 157 }, { 0x00a7,  21 },
+    { 0x00aa, 166 }, { 0x00ab, 174 }, { 0x00ac, 170 }, { 0x00b0, 248 }, { 0x00b1, 241 }, { 0x00b2, 253 },
+    { 0x00b5, 230 }, { 0x00b6,  20 }, { 0x00b7, 250 }, { 0x00ba, 167 }, { 0x00bb, 175 }, { 0x00bc, 172 },
+    { 0x00bd, 171 }, { 0x00bf, 168 }, { 0x00c4, 142 }, { 0x00c5, 143 }, { 0x00c6, 146 }, { 0x00c7, 128 },
+    { 0x00c9, 144 }, { 0x00d1, 165 }, { 0x00d6, 153 }, { 0x00dc, 154 }, { 0x00df, 225 }, { 0x00e0, 133 },
+    { 0x00e1, 160 }, { 0x00e2, 131 }, { 0x00e4, 132 }, { 0x00e5, 134 }, { 0x00e6, 145 }, { 0x00e7, 135 },
+    { 0x00e8, 138 }, { 0x00e9, 130 }, { 0x00ea, 136 }, { 0x00eb, 137 }, { 0x00ec, 141 }, { 0x00ed, 161 },
+    { 0x00ee, 140 }, { 0x00ef, 139 }, { 0x00f1, 164 }, { 0x00f2, 149 }, { 0x00f3, 162 }, { 0x00f4, 147 },
+    { 0x00f6, 148 }, { 0x00f7, 246 }, { 0x00f9, 151 }, { 0x00fa, 163 }, { 0x00fb, 150 }, { 0x00fc, 129 },
+    { 0x00ff, 152 }, { 0x0192, 159 }, { 0x0393, 226 }, { 0x0398, 233 }, { 0x03a3, 228 }, { 0x03a6, 232 },
+    { 0x03a9, 234 }, { 0x03b1, 224 }, { 0x03b4, 235 }, { 0x03b5, 238 }, { 0x03c0, 227 }, { 0x03c3, 229 },
+    { 0x03c4, 231 }, { 0x03c6, 237 }, { 0x2022,   7 }, { 0x203c,  19 }, { 0x207f, 252 }, { 0x20a7, 158 },
+    { 0x2190,  27 }, { 0x2191,  24 }, { 0x2192,  26 }, { 0x2193,  25 }, { 0x2194,  29 }, { 0x2195,  18 },
+    { 0x21a8,  23 }, { 0x2219, 249 }, { 0x221a, 251 }, { 0x221e, 236 }, { 0x221f,  28 }, { 0x2229, 239 },
+    { 0x2248, 247 }, { 0x2261, 240 }, { 0x2264, 243 }, { 0x2265, 242 }, { 0x2302, 127 }, { 0x2310, 169 },
+    { 0x2320, 244 }, { 0x2321, 245 }, { 0x2500, 196 }, { 0x2502, 179 }, { 0x250c, 218 }, { 0x2510, 191 },
+    { 0x2514, 192 }, { 0x2518, 217 }, { 0x251c, 195 }, { 0x2524, 180 }, { 0x252c, 194 }, { 0x2534, 193 },
+    { 0x253c, 197 }, { 0x2550, 205 }, { 0x2551, 186 }, { 0x2552, 213 }, { 0x2553, 214 }, { 0x2554, 201 },
+    { 0x2555, 184 }, { 0x2556, 183 }, { 0x2557, 187 }, { 0x2558, 212 }, { 0x2559, 211 }, { 0x255a, 200 },
+    { 0x255b, 190 }, { 0x255c, 189 }, { 0x255d, 188 }, { 0x255e, 198 }, { 0x255f, 199 }, { 0x2560, 204 },
+    { 0x2561, 181 }, { 0x2562, 182 }, { 0x2563, 185 }, { 0x2564, 209 }, { 0x2565, 210 }, { 0x2566, 203 },
+    { 0x2567, 207 }, { 0x2568, 208 }, { 0x2569, 202 }, { 0x256a, 216 }, { 0x256b, 215 }, { 0x256c, 206 },
+    { 0x2580, 223 }, { 0x2584, 220 }, { 0x2588, 219 }, { 0x258c, 221 }, { 0x2590, 222 }, { 0x2591, 176 },
+    { 0x2592, 177 }, { 0x2593, 178 }, { 0x25a0, 254 }, { 0x25ac,  22 }, { 0x25b2,  30 }, { 0x25ba,  16 },
+    { 0x25bc,  31 }, { 0x25c4,  17 }, { 0x25cb,   9 }, { 0x25d8,   8 }, { 0x25d9,  10 }, { 0x263a,   1 },
+    { 0x263b,   2 }, { 0x263c,  15 }, { 0x2640,  12 }, { 0x2642,  11 }, { 0x2660,   6 }, { 0x2663,   5 },
+    { 0x2665,   3 }, { 0x2666,   4 }, { 0x266a,  13 }, { 0x266b,  14 },
+};
+
+int fontAtlasGlyph(u32 codepoint)
+{
+    if (codepoint >= ' ' && codepoint < 0x7f) return (int)codepoint;
+
+    int lo = 0;
+    int hi = (int)(sizeof(kCp437) / sizeof(kCp437[0]));
+    while (lo < hi)
+    {
+        int mid = (lo + hi) / 2;
+        if (kCp437[mid].codepoint < codepoint) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo < (int)(sizeof(kCp437) / sizeof(kCp437[0])) && kCp437[lo].codepoint == codepoint ? kCp437[lo].glyph : -1;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void fontAtlasFromImage(FontAtlas* atlas, const u32* image, int width, int height)
+{
+    memoryClear(atlas, sizeof(*atlas));
+    atlas->glyphWidth = width / 16;
+    atlas->glyphHeight = height / 16;
+    atlas->numGlyphs = 256;
+    atlas->rowBytes = (atlas->glyphWidth + 7) / 8;
+    atlas->owned = K_ALLOC_CLEAR(fontAtlasBitsSize(atlas));
+    atlas->bits = atlas->owned;
+
+    u8* row = atlas->owned;
+    for (int g = 0; g < atlas->numGlyphs; ++g)
+    {
+        const u32* src = image + (g / 16) * atlas->glyphHeight * width + (g % 16) * atlas->glyphWidth;
+        for (int y = 0; y < atlas->glyphHeight; ++y, src += width, row += atlas->rowBytes)
+        {
+            for (int x = 0; x < atlas->glyphWidth; ++x)
+            {
+                if ((src[x] & 0xff) >= 128) row[x >> 3] |= (u8)(1 << (x & 7));
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+bool fontAtlasSave(const FontAtlas* atlas, const char* fileName)
+{
+    FILE* f = fopen(fileName, "wb");
+    if (!f) return NO;
+
+    FontFileHeader header;
+    header.magic = FONT_FILE_MAGIC;
+    header.version = FONT_FILE_VERSION;
+    header.glyphWidth = (u32)atlas->glyphWidth;
+    header.glyphHeight = (u32)atlas->glyphHeight;
+    header.numGlyphs = (u32)atlas->numGlyphs;
+    header.rowBytes = (u32)atlas->rowBytes;
+
+    size_t size = (size_t)fontAtlasBitsSize(atlas);
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1 && fwrite(atlas->bits, 1, size, f) == size;
+    return (fclose(f) == 0) && ok;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void fontAtlasDone(FontAtlas* atlas)
+{
+    if (atlas->owned) K_FREE(atlas->owned, fontAtlasBitsSize(atlas));
+    memoryClear(atlas, sizeof(*atlas));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,72 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       fontatlas.h
+//! @brief      1-bit font atlases and their precompiled file format.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <game.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// Fonts are drawn 1 bit per pixel: a pixel is lit if the red channel of the source image is at least 128, which is
+// the test the shaders used to make on the RGBA texture.  A .fnt file holds exactly those bits, so it can be mapped
+// and used without decoding, or embedded in the executable.  tools/fontconv.c converts the PNG atlases (16 glyphs per row) into .fnt files.
+//
+// File layout (little-endian):
+//
+//      FontFileHeader
+//      numGlyphs * glyphHeight rows of rowBytes bytes: glyph 0 row 0, glyph 0 row 1, ...  Bit x of a row (least
+//      significant bit of the first byte first) is set if pixel x is lit.
+//----------------------------------------------------------------------------------------------------------------------
+
+#define FONT_FILE_MAGIC     0x544e4f46      // "FONT"
+#define FONT_FILE_VERSION   1
+
+STRUCT_START(FontFileHeader)
+{
+    u32     magic;
+    u32     version;
+    u32     glyphWidth;
+    u32     glyphHeight;
+    u32     numGlyphs;
+    u32     rowBytes;       // (glyphWidth + 7) / 8
+}
+STRUCT_END(FontFileHeader);
+
+STRUCT_START(FontAtlas)
+{
+    int         glyphWidth;
+    int         glyphHeight;
+    int         numGlyphs;
+    int         rowBytes;
+    const u8*   bits;       // Glyph rows as described above
+    u8*         owned;      // Heap copy if the atlas was converted from an image
+}
+STRUCT_END(FontAtlas);
+
+// Use the contents of a .fnt file in place.  The atlas points into bytes, which must outlive it.  Returns NO if they
+// are not a valid font file.
+bool fontAtlasLoad(FontAtlas* atlas, const u8* bytes, i64 size);
+
+// Convert an RGBA (0xAABBGGRR) image of 16 x 16 glyphs.
+void fontAtlasFromImage(FontAtlas* atlas, const u32* image, int width, int height);
+
+bool fontAtlasSave(const FontAtlas* atlas, const char* fileName);
+void fontAtlasDone(FontAtlas* atlas);
+
+// Size of the bitmap data in bytes.
+i64 fontAtlasBitsSize(const FontAtlas* atlas);
+
+// The atlases are laid out as code page 437.  Returns the glyph drawn for a Unicode codepoint, or -1 if there isn't
+// one (including for control codes).
+int fontAtlasGlyph(u32 codepoint);
+
+internal inline bool fontAtlasLit(const FontAtlas* atlas, int glyph, int x, int y)
+{
+    const u8* row = atlas->bits + ((i64)glyph * atlas->glyphHeight + y) * atlas->rowBytes;
+    return (row[x >> 3] >> (x & 7)) & 1;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -6,178 +6,224 @@
 //----------------------------------------------------------------------------------------------------------------------
 
 #include <game.h>
+#include <canvas.h>
+#include <cellrow.h>
+#include <journal.h>
+
+#include <string.h>
 
 //----------------------------------------------------------------------------------------------------------------------
 // World
 //----------------------------------------------------------------------------------------------------------------------
 
-STRUCT_START(Region)
+// Tracks the letter command that later letters may be merged into.
+STRUCT_START(LetterRun)
 {
-    u32*    fore;
-    u32*    back;
-    u32*    text;
-    int     x, y;
-    int     w, h;
+    bool            open;       // YES = the last command was a letter that can be extended
+    int             x, y;       // Where the next letter must go to extend the run
+    int             length;     // Number of letters in the run
+    f64             time;       // Time of the last letter
 }
-STRUCT_END(Region);
-
-STRUCT_START(Command)
-{
-    Region doCmd;
-    Region undoCmd;
-    int width;
-    int height;
-}
-STRUCT_END(Command);
+STRUCT_END(LetterRun);
 
 STRUCT_START(World)
 {
     f64             t;          // Timer
+    f64             time;       // Total time simulated
     int             x, y;       // Cursor coords
+    int             viewX, viewY;           // Scroll position: canvas coords of the top-left cell on screen
     bool            showHelp;   // YES = show help
     bool            cursorOn;   // Cursor is currently flashing on.
-    Region          screen;     // Current screen
-    Array(Command)  commands;   // Undo stack
-    int             cmdIndex;
+    CursorStyle     cursorStyle;            // How the cursor is drawn when it is on
+    u8              font;                   // Font that letters are typed in (CELL_FONT_GRID or a font number)
+    Canvas          screen;     // Current screen
+    u32             palette[PALETTE_SIZE];  // Colours referred to by cells
+    int             theme;                  // Index into kThemes
+    bool            cycling;                // YES = the bright colours are being cycled
+    int             cycle;                  // Steps the bright colours have been rotated by
+    f64             cycleTime;              // Time since the last step
+    Journal         history;    // Undo/redo journal
+    CoalescePolicy  coalesce;   // How letters are merged into undo records
+    LetterRun       run;        // Current letter run
+    bool            paletteDirty;           // YES = palette needs sending to the renderer
+    Cursor          shownCursor;            // Cursor given out by the last present()
+    Viewport        shownView;              // Viewport the image held after the last present()
 }
 STRUCT_END(World);
 
 World gWorld;
 
+// Cells used for areas of the world that have not been written to yet.
+#define SCREEN_CLEAR_CELL   cellMake(' ', COLOUR_BRIGHT_RED, COLOUR_BLACK, 0)
+#define SCREEN_BORDER_CELL  cellMake('.', COLOUR_BRIGHT_RED, COLOUR_BLACK, 0)
+
+// Seconds between cursor flashes.
+#define CURSOR_BLINK_PERIOD 0.25
+
+// Seconds between steps of the colour cycle.
+#define PALETTE_CYCLE_PERIOD    0.125
+
+// Width and height of the world in cells.  The cursor and viewport are kept inside it.
+#define WORLD_SIZE          4096
+
 //----------------------------------------------------------------------------------------------------------------------
-// Region control
+// Palette
 //----------------------------------------------------------------------------------------------------------------------
 
-// Copies a rectangle from a source 2D array with width 'srcWidth' to a destination 2D array with dimensions w, h.
-void copyToRegion(int x, int y, int w, int h, int srcWidth, int srcHeight, const u32* src, u32* dst)
+internal u32 colourMake(u32 r, u32 g, u32 b)
 {
-    blit(dst, sizeMake(w, h), src, sizeMake(srcWidth, srcHeight), 0, 0, x, y, w, h, (int)sizeof(u32));
+    return 0xff000000 | (b << 16) | (g << 8) | r;
 }
 
-void copyFromRegion(int x, int y, int w, int h, int dstWidth, int dstHeight, const u32* src, u32* dst)
+// Themes replace the 16 system colours.  Cells only hold palette indices, so switching theme recolours the whole
+// canvas without touching a single cell.
+internal const u32 kThemes[][16] =
 {
-    blit(dst, sizeMake(dstWidth, dstHeight), src, sizeMake(w, h), x, y, 0, 0, w, h, (int)sizeof(u32));
-}
+    // Standard terminal colours
+    {
+        0xff000000, 0xff000080, 0xff008000, 0xff008080, 0xff800000, 0xff800080, 0xff808000, 0xffc0c0c0,
+        0xff808080, 0xff0000ff, 0xff00ff00, 0xff00ffff, 0xffff0000, 0xffff00ff, 0xffffff00, 0xffffffff,
+    },
+    // Solarized dark
+    {
+        0xff423607, 0xff2f32dc, 0xff009985, 0xff0089b5, 0xffd28b26, 0xff8236d3, 0xff98a12a, 0xffd5e8ee,
+        0xff362b00, 0xff164bcb, 0xff756e58, 0xff837b65, 0xff969483, 0xffc4716c, 0xffa1a193, 0xffe3f6fd,
+    },
+    // Amber phosphor
+    {
+        0xff000000, 0xff004f73, 0xff00618c, 0xff0072a6, 0xff005880, 0xff006a99, 0xff007bb2, 0xff008dcc,
+        0xff00354c, 0xff0096d9, 0xff009ee6, 0xff00a2eb, 0xff0084bf, 0xff009be0, 0xff00a7f2, 0xff00b0ff,
+    },
+    // Green phosphor
+    {
+        0xff000000, 0xff177317, 0xff1c8c1c, 0xff21a621, 0xff1a801a, 0xff1f991f, 0xff24b224, 0xff29cc29,
+        0xff0f4c0f, 0xff2bd92b, 0xff2ee62e, 0xff2feb2f, 0xff26bf26, 0xff2de02d, 0xff30f230, 0xff33ff33,
+    },
+};
 
-// Initialise a region and optionally copy data from the screen
-void newRegion(Region* reg, int x, int y, int w, int h, bool copyScreen)
+#define NUM_THEMES          (int)(sizeof(kThemes) / sizeof(kThemes[0]))
+
+// The colour cycle rotates the six bright colours from red to cyan.
+#define CYCLE_FIRST         COLOUR_BRIGHT_RED
+#define CYCLE_LENGTH        (COLOUR_BRIGHT_CYAN - COLOUR_BRIGHT_RED + 1)
+
+// Builds the 256 colour palette: 16 system colours from a theme, a 6x6x6 colour cube and a 24 step grey ramp.
+internal void initPalette(u32* palette, const u32* system)
 {
-    reg->fore = K_ALLOC(w * h * sizeof(u32));
-    reg->back = K_ALLOC(w * h * sizeof(u32));
-    reg->text = K_ALLOC(w * h * sizeof(u32));
-    reg->x = x;
-    reg->y = y;
-    reg->w = w;
-    reg->h = h;
-    if (copyScreen)
+    static const u32 kLevels[6] = { 0, 95, 135, 175, 215, 255 };
+
+    int i = 0;
+    for (; i < 16; ++i) palette[i] = system[i];
+    for (int r = 0; r < 6; ++r)
+        for (int g = 0; g < 6; ++g)
+            for (int b = 0; b < 6; ++b)
+                palette[i++] = colourMake(kLevels[r], kLevels[g], kLevels[b]);
+    for (int grey = 0; grey < 24; ++grey)
     {
-        copyToRegion(x, y, w, h, gWorld.screen.w, gWorld.screen.h, gWorld.screen.fore, reg->fore);
-        copyToRegion(x, y, w, h, gWorld.screen.w, gWorld.screen.h, gWorld.screen.back, reg->back);
-        copyToRegion(x, y, w, h, gWorld.screen.w, gWorld.screen.h, gWorld.screen.text, reg->text);
+        u32 l = 8 + grey * 10;
+        palette[i++] = colourMake(l, l, l);
     }
 }
 
-internal void killRegion(RegionRef region)
+// Rewrite the system colours for the current theme and cycle step.  Only the palette is sent to the renderer, so
+// however much of the screen uses these colours, nothing else is uploaded.
+internal void updateSystemColours()
 {
-    K_FREE(region->fore, region->w * region->h * sizeof(u32));
-    K_FREE(region->back, region->w * region->h * sizeof(u32));
-    K_FREE(region->text, region->w * region->h * sizeof(u32));
+    const u32* system = kThemes[gWorld.theme];
+
+    for (int i = 0; i < 16; ++i) gWorld.palette[i] = system[i];
+    for (int i = 0; i < CYCLE_LENGTH; ++i)
+    {
+        gWorld.palette[CYCLE_FIRST + i] = system[CYCLE_FIRST + (i + gWorld.cycle) % CYCLE_LENGTH];
+    }
+    gWorld.paletteDirty = YES;
 }
 
-void applyRegion(Region* reg)
+//----------------------------------------------------------------------------------------------------------------------
+// Region control
+//----------------------------------------------------------------------------------------------------------------------
+
+// Start a new undoable command.  Any undone commands are lost.
+void newCommand()
 {
-    copyFromRegion(reg->x, reg->y, reg->w, reg->h, gWorld.screen.w, gWorld.screen.h, reg->fore, gWorld.screen.fore);
-    copyFromRegion(reg->x, reg->y, reg->w, reg->h, gWorld.screen.w, gWorld.screen.h, reg->back, gWorld.screen.back);
-    copyFromRegion(reg->x, reg->y, reg->w, reg->h, gWorld.screen.w, gWorld.screen.h, reg->text, gWorld.screen.text);
+    journalBegin(&gWorld.history);
 }
 
-void prepareScreen(int x, int y, int w, int h)
+// Write a rectangle of cells to the screen as part of the current command.
+void applyRegion(int x, int y, int w, int h, const Cell* cells)
 {
-    int newW = x + w;
-    int newH = y + h;
-    if (newW > gWorld.screen.w ||
-        newH > gWorld.screen.h)
-    {
-        newW = K_MAX(newW, gWorld.screen.w);
-        newH = K_MAX(newH, gWorld.screen.h);
-        u32* fore = K_ALLOC(newW * newH * sizeof(u32));
-        u32* back = K_ALLOC(newW * newH * sizeof(u32));
-        u32* text = K_ALLOC(newW * newH * sizeof(u32));
-
-        u32* f = fore;
-        u32* b = back;
-        u32* t = text;
-
-        for (int i = 0; i < (newW * newH); ++i)
-        {
-            *f++ = 0xff0000ff;
-            *b++ = 0xff000000;
-            *t++ = (u32)' ';
-        }
+    journalApply(&gWorld.history, &gWorld.screen, x, y, w, h, cells);
+}
 
-        if (gWorld.screen.fore)
-        {
-            blit(
-                fore, sizeMake(newW, newH),
-                gWorld.screen.fore, sizeMake(gWorld.screen.w, gWorld.screen.h),
-                0, 0, 0, 0, gWorld.screen.w, gWorld.screen.h, sizeof(u32));
-            blit(
-                back, sizeMake(newW, newH),
-                gWorld.screen.back, sizeMake(gWorld.screen.w, gWorld.screen.h),
-                0, 0, 0, 0, gWorld.screen.w, gWorld.screen.h, sizeof(u32));
-            blit(
-                text, sizeMake(newW, newH),
-                gWorld.screen.text, sizeMake(gWorld.screen.w, gWorld.screen.h),
-                0, 0, 0, 0, gWorld.screen.w, gWorld.screen.h, sizeof(u32));
-        }
+//----------------------------------------------------------------------------------------------------------------------
+// Commands
+//----------------------------------------------------------------------------------------------------------------------
 
-        killRegion(&gWorld.screen);
-        gWorld.screen.w = newW;
-        gWorld.screen.h = newH;
-        gWorld.screen.fore = fore;
-        gWorld.screen.back = back;
-        gWorld.screen.text = text;
-    }
+// Returns YES if a typed codepoint can be written to a cell: anything but control codes, surrogates and values past
+// the end of Unicode.
+internal bool isPrintable(u32 c)
+{
+    return c >= ' ' && !(c >= 0x7f && c < 0xa0) && !(c >= 0xd800 && c < 0xe000) && c <= 0x10ffff;
 }
 
-internal void deleteCommand(int index)
+// Returns YES if a letter at (x, y) can be merged into the current letter run.
+internal bool canExtendRun(int x, int y)
 {
-    Command* cmd = &gWorld.commands[index];
-    killRegion(&cmd->doCmd);
-    killRegion(&cmd->undoCmd);
+    const LetterRun* run = &gWorld.run;
+    const CoalescePolicy* policy = &gWorld.coalesce;
+
+    return
+        run->open &&
+        journalIsOpen(&gWorld.history) &&
+        x == run->x && y == run->y &&
+        (gWorld.time - run->time) <= policy->burstGap &&
+        (policy->maxRun == 0 || run->length < policy->maxRun);
 }
 
-Command* newCommand(int x, int y, int w, int h)
+void commandLetter(int x, int y, u32 c)
 {
-    prepareScreen(x, y, w, h);
+    Cell cell = cellMake(c, COLOUR_WHITE, COLOUR_BLACK, 0);
+    cell.font = gWorld.font;
 
-    // Delete all commands after the current index
-    while (arrayCount(gWorld.commands) > gWorld.cmdIndex)
+    if (canExtendRun(x, y))
     {
-        deleteCommand(gWorld.cmdIndex);
+        ++gWorld.run.length;
     }
+    else
+    {
+        newCommand();
+        gWorld.run.open = YES;
+        gWorld.run.length = 1;
+    }
+    applyRegion(x, y, 1, 1, &cell);
 
-    Command* cmd = arrayNew(gWorld.commands);
-    gWorld.cmdIndex = (int)arrayCount(gWorld.commands);
-
-    newRegion(&cmd->undoCmd, x, y, w, h, YES);
-    newRegion(&cmd->doCmd, x, y, w, h, NO);
-
-    return cmd;
+    gWorld.run.x = x + 1;
+    gWorld.run.y = y;
+    gWorld.run.time = gWorld.time;
+    ++gWorld.x;
 }
 
-//----------------------------------------------------------------------------------------------------------------------
-// Commands
-//----------------------------------------------------------------------------------------------------------------------
+void commandUndo()
+{
+    gWorld.run.open = NO;
+    const Delta* d = journalUndo(&gWorld.history, &gWorld.screen);
+    if (d)
+    {
+        // Leave the cursor where the undone command started.
+        gWorld.x = d->x;
+        gWorld.y = d->y;
+    }
+}
 
-void commandLetter(int x, int y, char c)
+void commandRedo()
 {
-    Command* cmd = newCommand(x, y, 1, 1);
-    *cmd->doCmd.fore = 0xffffffff;
-    *cmd->doCmd.back = 0xff000000;
-    *cmd->doCmd.text = (u32)c;
-    applyRegion(&cmd->doCmd);
-    ++gWorld.x;
+    gWorld.run.open = NO;
+    const Delta* d = journalRedo(&gWorld.history, &gWorld.screen);
+    if (d)
+    {
+        gWorld.x = d->x + 1;
+        gWorld.y = d->y;
+    }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -187,6 +233,13 @@ void commandLetter(int x, int y, char c)
 void init()
 {
     memoryClear(&gWorld, sizeof(World));
+    initPalette(gWorld.palette, kThemes[0]);
+    gWorld.paletteDirty = YES;
+    gWorld.cursorStyle = CURSOR_BLOCK;
+    canvasInit(&gWorld.screen, SCREEN_CLEAR_CELL);
+    journalInit(&gWorld.history);
+    gWorld.coalesce.burstGap = 1.0;
+    gWorld.coalesce.maxRun = 0;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -195,32 +248,68 @@ void init()
 
 void done()
 {
-    killRegion(&gWorld.screen);
-    arrayFor(gWorld.commands)
-    {
-        killRegion(&gWorld.commands[i].doCmd);
-        killRegion(&gWorld.commands[i].undoCmd);
-    }
-    arrayDone(gWorld.commands);
+    canvasDone(&gWorld.screen);
+    journalDone(&gWorld.history);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Configuration
+//----------------------------------------------------------------------------------------------------------------------
+
+void setCoalescePolicy(const CoalescePolicy* policy)
+{
+    gWorld.coalesce = *policy;
+    gWorld.run.open = NO;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 // Simulate
 //----------------------------------------------------------------------------------------------------------------------
 
+// Keep the viewport inside the world and the cursor inside the viewport.  If the view was panned, the cursor is
+// dragged along with it; otherwise the view scrolls to the cursor.
+internal void followCursor(int width, int height, bool pan)
+{
+    if (pan)
+    {
+        gWorld.viewX = K_MAX(0, K_MIN(gWorld.viewX, WORLD_SIZE - width));
+        gWorld.viewY = K_MAX(0, K_MIN(gWorld.viewY, WORLD_SIZE - height));
+        gWorld.x = K_MAX(gWorld.viewX, K_MIN(gWorld.x, gWorld.viewX + width - 1));
+        gWorld.y = K_MAX(gWorld.viewY, K_MIN(gWorld.y, gWorld.viewY + height - 1));
+    }
+    else
+    {
+        gWorld.viewX = K_MAX(gWorld.x - width + 1, K_MIN(gWorld.viewX, gWorld.x));
+        gWorld.viewY = K_MAX(gWorld.y - height + 1, K_MIN(gWorld.viewY, gWorld.y));
+        gWorld.viewX = K_MAX(0, K_MIN(gWorld.viewX, WORLD_SIZE - width));
+        gWorld.viewY = K_MAX(0, K_MIN(gWorld.viewY, WORLD_SIZE - height));
+    }
+}
+
 bool simulate(const SimulateIn* sim)
 {
     bool result = YES;
-    static const f64 clock = 0.25;
 
+    gWorld.time += sim->dt;
     gWorld.t += sim->dt;
-    if (gWorld.t > clock)
+    if (gWorld.t >= CURSOR_BLINK_PERIOD)
     {
         //t -= clock;
         gWorld.t = 0.0;
         gWorld.cursorOn = !gWorld.cursorOn;
     }
 
+    if (gWorld.cycling)
+    {
+        gWorld.cycleTime += sim->dt;
+        if (gWorld.cycleTime >= PALETTE_CYCLE_PERIOD)
+        {
+            gWorld.cycleTime = 0.0;
+            gWorld.cycle = (gWorld.cycle + 1) % CYCLE_LENGTH;
+            updateSystemColours();
+        }
+    }
+
     i64 numKeyEvents = arrayCount(sim->key);
     if (numKeyEvents)
     {
@@ -230,6 +319,7 @@ bool simulate(const SimulateIn* sim)
         for (i64 i = 0; i < numKeyEvents; ++i)
         {
             KeyState* kev = &sim->key[i];
+            bool pan = NO;
             if (kev->down)
             {
                 if (!kev->shift && !kev->ctrl && !kev->alt) switch(kev->vkey)
@@ -242,6 +332,31 @@ bool simulate(const SimulateIn* sim)
                 case VK_RIGHT:  ++gWorld.x;     break;
                 case VK_UP:     --gWorld.y;     break;
                 case VK_DOWN:   ++gWorld.y;     break;
+                case VK_PRIOR:  gWorld.viewY -= sim->height;    gWorld.y -= sim->height;    break;
+                case VK_NEXT:   gWorld.viewY += sim->height;    gWorld.y += sim->height;    break;
+
+                case VK_F2:
+                    // Cycle through the visible cursor styles.
+                    gWorld.cursorStyle = gWorld.cursorStyle % (CURSOR_COUNT - 1) + 1;
+                    break;
+
+                case VK_F4:
+                    // Cycle the font that letters are typed in: the grid's font, then each font in turn.
+                    gWorld.font = (u8)((gWorld.font + 1) % (K_MIN(sim->numFonts, 255) + 1));
+                    break;
+
+                case VK_F5:
+                    gWorld.theme = (gWorld.theme + 1) % NUM_THEMES;
+                    updateSystemColours();
+                    break;
+
+                case VK_F6:
+                    // Start or stop cycling the bright colours.  Stopping puts them back in order.
+                    gWorld.cycling = !gWorld.cycling;
+                    gWorld.cycle = 0;
+                    gWorld.cycleTime = 0.0;
+                    updateSystemColours();
+                    break;
                 }
 
                 if (kev->shift && !kev->ctrl && !kev->alt) switch (kev->vkey)
@@ -252,75 +367,223 @@ bool simulate(const SimulateIn* sim)
                 case VK_DOWN:   gWorld.y += 10;     break;
                 }
 
-                if (!kev->vkey && (kev->ch >= ' ' && kev->ch < 127))
+                if (!kev->shift && kev->ctrl && !kev->alt) switch (kev->vkey)
+                {
+                case 'Z':       commandUndo();      break;
+                case 'Y':       commandRedo();      break;
+
+                case VK_LEFT:   --gWorld.viewX;     pan = YES;  break;
+                case VK_RIGHT:  ++gWorld.viewX;     pan = YES;  break;
+                case VK_UP:     --gWorld.viewY;     pan = YES;  break;
+                case VK_DOWN:   ++gWorld.viewY;     pan = YES;  break;
+                }
+
+                if (!kev->vkey && isPrintable(kev->ch))
                 {
-                    commandLetter(gWorld.x, gWorld.y, (char)kev->ch);
+                    commandLetter(gWorld.x, gWorld.y, kev->ch);
                 }
             }
+
+            // Keep cursor in bounds after every event, so a later letter in the same frame can't be written outside
+            // the world.
+            gWorld.x = K_MAX(0, K_MIN(gWorld.x, WORLD_SIZE - 1));
+            gWorld.y = K_MAX(0, K_MIN(gWorld.y, WORLD_SIZE - 1));
+            followCursor(sim->width, sim->height, pan);
+
+            // Moving the cursor ends the letter run, so a letter typed back where the run left off starts a new undo
+            // record even within the burst gap.
+            if (gWorld.x != gWorld.run.x || gWorld.y != gWorld.run.y) gWorld.run.open = NO;
         }
-        
-        // Keep cursor in bounds
-        if (gWorld.x < 0) gWorld.x = 0;
-        if (gWorld.y < 0) gWorld.y = 0;
-        if (gWorld.x >= sim->width) gWorld.x = sim->width - 1;
-        if (gWorld.y >= sim->height) gWorld.y = sim->height - 1;
+    }
+    else
+    {
+        // The viewport may have changed size.
+        followCursor(sim->width, sim->height, NO);
     }
 
     return result;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// Scheduling
+//----------------------------------------------------------------------------------------------------------------------
+
+// The cursor as it should be drawn now.
+internal Cursor currentCursor()
+{
+    Cursor cursor;
+    cursor.x = gWorld.x;
+    cursor.y = gWorld.y;
+    cursor.style = gWorld.cursorOn ? gWorld.cursorStyle : CURSOR_NONE;
+    cursor.colour = COLOUR_BRIGHT_RED;
+    cursor.textColour = COLOUR_WHITE;
+    return cursor;
+}
+
+// YES if the cursor has to be redrawn.
+internal bool cursorChanged()
+{
+    Cursor cursor = currentCursor();
+    const Cursor* shown = &gWorld.shownCursor;
+
+    return cursor.style != shown->style ||
+        (cursor.style != CURSOR_NONE && (cursor.x != shown->x || cursor.y != shown->y));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+f64 timeUntilUpdate()
+{
+    f64 t = CURSOR_BLINK_PERIOD - gWorld.t;
+    if (gWorld.cycling) t = K_MIN(t, PALETTE_CYCLE_PERIOD - gWorld.cycleTime);
+    return K_MAX(t, 0.0);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+bool needsPresent()
+{
+    return gWorld.screen.damage.count > 0 || gWorld.paletteDirty || cursorChanged() ||
+        gWorld.viewX != gWorld.shownView.x || gWorld.viewY != gWorld.shownView.y;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // Present
 //----------------------------------------------------------------------------------------------------------------------
 
-void present(const PresentIn* pin)
+// Split the range [start, start + length) at 'at', returning the number of pieces.
+internal int splitRange(int start, int length, int at, int* starts, int* lengths)
 {
-    int row, col;
-    // f = fore, b = back, t = text
-    // d = destination, s = source
-    u32* fd = pin->foreImage;
-    u32* bd = pin->backImage;
-    u32* td = pin->textImage;
-    u32* fs = gWorld.screen.fore;
-    u32* bs = gWorld.screen.back;
-    u32* ts = gWorld.screen.text;
-
-    int sStride = gWorld.screen.w < pin->width ? 0 : (gWorld.screen.w - pin->width);
-
-    for (row = 0; row < K_MIN(gWorld.screen.h, pin->height); ++row)
+    if (at > start && at < start + length)
     {
-        for (col = 0; col < K_MIN(gWorld.screen.w, pin->width); ++col)
-        {
-            *fd++ = *fs++;
-            *bd++ = *bs++;
-            *td++ = *ts++;
-        }
-        for (; col < pin->width; ++col)
-        {
-            *fd++ = 0xff0000ff;
-            *bd++ = 0xff000000;
-            *td++ = (u32)'.';
-        }
-        fs += sStride;
-        bs += sStride;
-        ts += sStride;
+        starts[0] = start;
+        lengths[0] = at - start;
+        starts[1] = at;
+        lengths[1] = start + length - at;
+        return 2;
+    }
+
+    starts[0] = start;
+    lengths[0] = length;
+    return 1;
+}
+
+// Redraw a rectangle of the image that doesn't cross the wrap-around seam, from the part of the canvas the viewport
+// keeps there.  Cells outside the written area get the border cell.
+internal void presentRect(const PresentIn* pin, const Viewport* view, int ix, int iy, int w, int h)
+{
+    Cell border = SCREEN_BORDER_CELL;
+    int x = view->x + (ix - view->x % view->w + view->w) % view->w;
+    int y = view->y + (iy - view->y % view->h + view->h) % view->h;
+    int copyW = K_MAX(0, K_MIN(gWorld.screen.w, x + w) - x);
+    int copyH = K_MAX(0, K_MIN(gWorld.screen.h, y + h) - y);
+    Cell* dst = &pin->cells[iy * pin->width + ix];
+
+    canvasRead(&gWorld.screen, x, y, copyW, copyH, dst, pin->width);
+
+    for (int row = 0; row < h; ++row)
+    {
+        int col = row < copyH ? copyW : 0;
+        cellFill(dst + row * pin->width + col, border, w - col);
     }
-    for (; row < pin->height; ++row)
+}
+
+// Clip each rectangle in 'damage' (image coords) to the image and redraw it, adding the clipped rectangles to 'out'.
+internal void presentDamage(const PresentIn* pin, const Viewport* view, const Damage* damage, Damage* out)
+{
+    int seamX = view->x % view->w;
+    int seamY = view->y % view->h;
+
+    for (int i = 0; i < damage->count; ++i)
     {
-        for (col = 0; col < pin->width; ++col)
+        DamageRect r = damage->rects[i];
+        int x0 = K_MAX(r.x, 0);
+        int y0 = K_MAX(r.y, 0);
+        int x1 = K_MIN(r.x + r.w, pin->width);
+        int y1 = K_MIN(r.y + r.h, pin->height);
+        if (x1 <= x0 || y1 <= y0) continue;
+
+        int xs[2], ws[2], ys[2], hs[2];
+        int nx = splitRange(x0, x1 - x0, seamX, xs, ws);
+        int ny = splitRange(y0, y1 - y0, seamY, ys, hs);
+        for (int sy = 0; sy < ny; ++sy)
         {
-            *fd++ = 0xff0000ff;
-            *bd++ = 0xff000000;
-            *td++ = (u32)'.';
+            for (int sx = 0; sx < nx; ++sx) presentRect(pin, view, xs[sx], ys[sy], ws[sx], hs[sy]);
         }
+
+        damageAdd(out, x0, y0, x1 - x0, y1 - y0);
     }
+}
 
-    if (gWorld.cursorOn)
+// Add the part of a canvas rectangle inside the viewport to damage in image coords.
+internal void damageAddCanvas(Damage* damage, const Viewport* view, int x, int y, int w, int h)
+{
+    int x0 = K_MAX(x, view->x);
+    int y0 = K_MAX(y, view->y);
+    int x1 = K_MIN(x + w, view->x + view->w);
+    int y1 = K_MIN(y + h, view->y + view->h);
+    if (x1 <= x0 || y1 <= y0) return;
+
+    // The image wraps around at the first multiple of its size after the viewport's origin.
+    int xs[2], ws[2], ys[2], hs[2];
+    int nx = splitRange(x0, x1 - x0, (view->x / view->w + 1) * view->w, xs, ws);
+    int ny = splitRange(y0, y1 - y0, (view->y / view->h + 1) * view->h, ys, hs);
+    for (int sy = 0; sy < ny; ++sy)
+    {
+        for (int sx = 0; sx < nx; ++sx) damageAdd(damage, xs[sx] % view->w, ys[sy] % view->h, ws[sx], hs[sy]);
+    }
+}
+
+void present(const PresentIn* pin)
+{
+    Damage damage;
+    damageClear(&damage);
+    damageClear(pin->damage);
+    if (pin->width <= 0 || pin->height <= 0) return;
+
+    Viewport view = { gWorld.viewX, gWorld.viewY, pin->width, pin->height };
+    const Viewport* shown = &gWorld.shownView;
+    bool overlap =
+        view.w == shown->w && view.h == shown->h &&
+        view.x < shown->x + shown->w && shown->x < view.x + view.w &&
+        view.y < shown->y + shown->h && shown->y < view.y + view.h;
+
+    // Gather everything that has changed since the last present, in image coords.
+    if (pin->full || !overlap)
     {
-        if (gWorld.x >= 0 && gWorld.y >= 0 && gWorld.x < pin->width && gWorld.y < pin->height)
+        damageAdd(&damage, 0, 0, pin->width, pin->height);
+        if (pin->full) gWorld.paletteDirty = YES;
+    }
+    else
+    {
+        const Damage* written = &gWorld.screen.damage;
+        for (int i = 0; i < written->count; ++i)
         {
-            pin->foreImage[gWorld.y * pin->width + gWorld.x] = 0xffffffff;
-            pin->backImage[gWorld.y * pin->width + gWorld.x] = 0xff0000ff;
+            const DamageRect* r = &written->rects[i];
+            damageAddCanvas(&damage, &view, r->x, r->y, r->w, r->h);
         }
+
+        // Columns and rows that have scrolled into view.  The rest of the image already holds the right cells.
+        int dx = view.x - shown->x;
+        int dy = view.y - shown->y;
+        if (dx < 0) damageAddCanvas(&damage, &view, view.x, view.y, -dx, view.h);
+        if (dx > 0) damageAddCanvas(&damage, &view, shown->x + shown->w, view.y, dx, view.h);
+        if (dy < 0) damageAddCanvas(&damage, &view, view.x, view.y, view.w, -dy);
+        if (dy > 0) damageAddCanvas(&damage, &view, view.x, shown->y + shown->h, view.w, dy);
+    }
+    damageClear(&gWorld.screen.damage);
+
+    presentDamage(pin, &view, &damage, pin->damage);
+
+    gWorld.shownView = view;
+    *pin->view = view;
+    gWorld.shownCursor = currentCursor();
+    *pin->cursor = gWorld.shownCursor;
+
+    if (gWorld.paletteDirty)
+    {
+        memcpy(pin->palette, gWorld.palette, sizeof(gWorld.palette));
+        pin->damage->palette = YES;
+        gWorld.paletteDirty = NO;
     }
 }
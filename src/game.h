@@ -12,6 +12,132 @@
 #define STRUCT_START(name) typedef struct _##name
 #define STRUCT_END(name) name, *name##Ref
 
+//----------------------------------------------------------------------------------------------------------------------
+// Cells
+//----------------------------------------------------------------------------------------------------------------------
+
+// Cell attribute bits.
+#define CELL_ATTR_INVERSE       0x01        // Swap fore and back colours
+#define CELL_ATTR_UNDERLINE     0x02        // Draw the bottom row of the cell in the fore colour
+
+// Cell fonts.  CELL_FONT_GRID draws a cell with the font the grid is sized for, which the player can change; 1 to
+// SimulateIn.numFonts always draw it with that one of the platform's fonts.  All cells are the same size, so a glyph
+// from a font of another size is drawn from the top-left corner of its cell and clipped to it.
+#define CELL_FONT_GRID          0
+
+// Number of entries in the colour palette.  Cells refer to colours by index into the palette.
+#define PALETTE_SIZE            256
+
+// Standard palette indices (the first 16 entries follow the usual terminal layout).
+enum
+{
+    COLOUR_BLACK,
+    COLOUR_RED,
+    COLOUR_GREEN,
+    COLOUR_YELLOW,
+    COLOUR_BLUE,
+    COLOUR_MAGENTA,
+    COLOUR_CYAN,
+    COLOUR_GREY,
+    COLOUR_DARK_GREY,
+    COLOUR_BRIGHT_RED,
+    COLOUR_BRIGHT_GREEN,
+    COLOUR_BRIGHT_YELLOW,
+    COLOUR_BRIGHT_BLUE,
+    COLOUR_BRIGHT_MAGENTA,
+    COLOUR_BRIGHT_CYAN,
+    COLOUR_WHITE,
+};
+
+// A single character cell.  The layout matches the RG32UI texel the renderer uploads (r = codepoint, g = fore |
+// back << 8 | attr << 16 | font << 24), so a row of cells is a single contiguous stream all the way from the world to
+// the GPU.
+STRUCT_START(Cell)
+{
+    u32     codepoint;  // Unicode; drawn blank if the cell's font has no glyph for it
+    u8      fore;       // Foreground palette index
+    u8      back;       // Background palette index
+    u8      attr;       // CELL_ATTR_xxx bits
+    u8      font;       // CELL_FONT_GRID or a font number
+}
+STRUCT_END(Cell);
+
+internal inline Cell cellMake(u32 codepoint, u8 fore, u8 back, u8 attr)
+{
+    Cell c = { codepoint, fore, back, attr, 0 };
+    return c;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Cursor
+// The renderers draw the cursor over the cells, so moving or flashing it never changes the cell image.
+//----------------------------------------------------------------------------------------------------------------------
+
+typedef enum
+{
+    CURSOR_NONE,                // Hidden or flashed off
+    CURSOR_BLOCK,               // Whole cell drawn in the cursor colours
+    CURSOR_UNDERLINE,           // Bottom CURSOR_THICKNESS pixel rows filled with the cursor colour
+    CURSOR_BAR,                 // Left CURSOR_THICKNESS pixel columns filled with the cursor colour
+
+    CURSOR_COUNT
+}
+CursorStyle;
+
+#define CURSOR_THICKNESS        2
+
+STRUCT_START(Cursor)
+{
+    int             x, y;           // Canvas coords
+    CursorStyle     style;
+    u8              colour;         // Palette index of a block's background, an underline or a bar
+    u8              textColour;     // Palette index of the glyph under a block
+}
+STRUCT_END(Cursor);
+
+//----------------------------------------------------------------------------------------------------------------------
+// Viewport
+// The part of the canvas on screen.  The presentation image is a wrap-around cache of it: canvas cell (x, y) is kept
+// at image cell (x % w, y % h), so scrolling only has to redraw the cells that come into view.
+//----------------------------------------------------------------------------------------------------------------------
+
+STRUCT_START(Viewport)
+{
+    int             x, y;           // Canvas coords of the top-left cell on screen
+    int             w, h;           // Size in cells
+}
+STRUCT_END(Viewport);
+
+//----------------------------------------------------------------------------------------------------------------------
+// Damage
+//----------------------------------------------------------------------------------------------------------------------
+
+// Maximum number of separate damage rectangles.  Beyond this, new damage is merged into the closest rectangle.
+#define MAX_DAMAGE_RECTS        16
+
+STRUCT_START(DamageRect)
+{
+    int     x, y;
+    int     w, h;
+}
+STRUCT_END(DamageRect);
+
+// A set of rectangles (in cells) that have changed since they were last consumed.
+STRUCT_START(Damage)
+{
+    int         count;
+    DamageRect  rects[MAX_DAMAGE_RECTS];
+    bool        palette;        // YES = the palette has changed
+}
+STRUCT_END(Damage);
+
+void damageClear(Damage* damage);
+void damageAdd(Damage* damage, int x, int y, int w, int h);
+
+//----------------------------------------------------------------------------------------------------------------------
+// Input/Output
+//----------------------------------------------------------------------------------------------------------------------
+
 STRUCT_START(KeyState)
 {
     bool down;
@@ -19,7 +145,7 @@ STRUCT_START(KeyState)
     bool ctrl;
     bool alt;
     int vkey;
-    char ch;
+    u32 ch;         // Unicode codepoint typed, if vkey is 0
 }
 STRUCT_END(KeyState);
 
@@ -38,8 +164,9 @@ STRUCT_START(SimulateIn)
     f64                 dt;
 
     // Screen meta-data
-    int                 width;
+    int                 width;          // Size of the viewport in cells
     int                 height;
+    int                 numFonts;       // Fonts that cells can choose (see CELL_FONT_GRID)
 
     // Input
     Array(KeyState)     key;
@@ -50,14 +177,28 @@ STRUCT_END(SimulateIn);
 STRUCT_START(PresentIn)
 {
     // Visuals
-    int                 width;
+    int                 width;          // Size of the viewport in cells
     int                 height;
-    u32*                foreImage;
-    u32*                backImage;
-    u32*                textImage;
+    Cell*               cells;          // width * height cells, kept from the previous present() (see Viewport)
+    u32*                palette;        // PALETTE_SIZE colours (0xAABBGGRR), written when damage->palette is set
+    bool                full;           // YES = cells and palette are invalid and must be completely rewritten
+
+    // Output
+    Damage*             damage;         // Receives the parts of cells that were rewritten
+    Cursor*             cursor;         // Receives the cursor to draw over the cells
+    Viewport*           view;           // Receives the part of the canvas the cells show
 }
 STRUCT_END(PresentIn);
 
+// Controls how consecutive typed letters are merged into a single undo record.  A letter extends the current record if
+// it lands directly after the previous one within burstGap seconds.
+STRUCT_START(CoalescePolicy)
+{
+    f64                 burstGap;       // Maximum seconds between letters in one record (0 = only simultaneous input)
+    int                 maxRun;         // Maximum letters in one record (0 = unlimited, 1 = never merge)
+}
+STRUCT_END(CoalescePolicy);
+
 //----------------------------------------------------------------------------------------------------------------------
 // Game API
 //----------------------------------------------------------------------------------------------------------------------
@@ -66,6 +207,13 @@ void init();
 void done();
 bool simulate(const SimulateIn* sim);
 void present(const PresentIn* pin);
+void setCoalescePolicy(const CoalescePolicy* policy);
+
+// Seconds until simulate() has work to do without any input, such as flashing the cursor.
+f64 timeUntilUpdate();
+
+// YES if present() would draw anything new.
+bool needsPresent();
 
 //----------------------------------------------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------------------------
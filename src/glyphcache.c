@@ -0,0 +1,333 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       glyphcache.c
+//! @brief      GPU cache of the glyphs the fonts don't have, filled on demand.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <glyphcache.h>
+
+#include <kore/kgl.h>
+
+// Map entry kept on the CPU only: there is no glyph for the codepoint.  The GPU's entry stays 0.
+#define GLYPH_NONE      0xffff
+
+STRUCT_START(GlyphCache)
+{
+    const RasterFont*   fonts;
+    int                 numFonts;
+    int                 rows;           // Texels per slot: at least the height of the tallest font
+    u16*                map;            // numFonts * GLYPH_MAP_SIZE entries, mirroring the map texture
+    GlyphSlots          slots;
+    u32*                glyphs;         // rows texels per slot, mirroring the cache texture so it can grow
+    bool                scanned;        // The whole image has been scanned during this update
+
+    GLuint              glyphTex;
+    GLuint              mapTex;
+    GlyphCacheStats     stats;
+}
+STRUCT_END(GlyphCache);
+
+internal GlyphCache gGlyphCache;
+
+//----------------------------------------------------------------------------------------------------------------------
+// Textures
+// The map lives on texture unit 2 and the cache on unit 4.  Unit 1 (the cell texture) is left active for the cell
+// texture functions.
+//----------------------------------------------------------------------------------------------------------------------
+
+internal void uploadSlot(int slot)
+{
+    GlyphCache* G = &gGlyphCache;
+    glActiveTexture(GL_TEXTURE4);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, slot, G->rows, 1, GL_RED_INTEGER, GL_UNSIGNED_INT,
+        G->glyphs + (i64)slot * G->rows);
+    glActiveTexture(GL_TEXTURE1);
+    G->stats.uploadBytes += (u64)G->rows * sizeof(u32);
+}
+
+internal void uploadMapEntry(int font, u32 codepoint, u16 entry)
+{
+    glActiveTexture(GL_TEXTURE2);
+    glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, codepoint & 255, codepoint >> 8, font, 1, 1, 1, GL_RED_INTEGER,
+        GL_UNSIGNED_SHORT, &entry);
+    glActiveTexture(GL_TEXTURE1);
+    gGlyphCache.stats.uploadBytes += sizeof(u16);
+}
+
+// (Re)allocate the cache texture for the current number of slots, filled from the CPU copy.
+internal void allocGlyphTexture()
+{
+    GlyphCache* G = &gGlyphCache;
+    glActiveTexture(GL_TEXTURE4);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R32UI, G->rows, G->slots.numSlots, 0, GL_RED_INTEGER, GL_UNSIGNED_INT,
+        G->glyphs);
+    glActiveTexture(GL_TEXTURE1);
+    G->stats.uploadBytes += (u64)G->rows * G->slots.numSlots * sizeof(u32);
+}
+
+// Fill in the font glyph entries of every layer of the map, and mark the codepoints with no glyph at all.  The rest
+// stay 0 until their glyphs are cached.
+internal void initMap()
+{
+    GlyphCache* G = &gGlyphCache;
+    u16* layer = G->map;
+    u32 masks[RASTER_MAX_GLYPH_WIDTH];
+    for (u32 c = 0; c < GLYPH_MAP_SIZE; ++c)
+    {
+        int glyph = fontAtlasGlyph(c);
+        if (glyph >= 0) layer[c] = (u16)(glyph + 1);
+        else layer[c] = rasterSynthGlyph(c, 1, 1, masks) ? 0 : GLYPH_NONE;
+    }
+
+    // The GPU sees 0 for codepoints with no glyph.
+    u16* texels = K_ALLOC(GLYPH_MAP_SIZE * sizeof(u16));
+    for (int i = 0; i < GLYPH_MAP_SIZE; ++i) texels[i] = layer[i] == GLYPH_NONE ? 0 : layer[i];
+
+    glActiveTexture(GL_TEXTURE2);
+    for (int i = 0; i < G->numFonts; ++i)
+    {
+        if (i > 0) memcpy(G->map + (i64)i * GLYPH_MAP_SIZE, layer, GLYPH_MAP_SIZE * sizeof(u16));
+        glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, i, 256, GLYPH_MAP_SIZE / 256, 1, GL_RED_INTEGER,
+            GL_UNSIGNED_SHORT, texels);
+    }
+    glActiveTexture(GL_TEXTURE1);
+    G->stats.uploadBytes += (u64)GLYPH_MAP_SIZE * sizeof(u16) * G->numFonts;
+    K_FREE(texels, GLYPH_MAP_SIZE * sizeof(u16));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Lookups
+//----------------------------------------------------------------------------------------------------------------------
+
+internal int cellFont(const Cell* cell, int gridFont)
+{
+    return cell->font == CELL_FONT_GRID ? gridFont : cell->font - 1;
+}
+
+// Map entry of a cell's glyph, or 0 if it is outside the map.
+internal u16* mapEntry(const Cell* cell, int gridFont)
+{
+    GlyphCache* G = &gGlyphCache;
+    int font = cellFont(cell, gridFont);
+    if (font >= G->numFonts || cell->codepoint >= GLYPH_MAP_SIZE) return 0;
+    return &G->map[(i64)font * GLYPH_MAP_SIZE + cell->codepoint];
+}
+
+internal bool isSlot(u16 entry)
+{
+    return entry > GLYPH_MAP_FONT_GLYPHS && entry != GLYPH_NONE;
+}
+
+// Mark every cached glyph in the image as in use, so that none of them is evicted during this update.
+internal void scanImage(const Cell* image, int count, int gridFont)
+{
+    GlyphCache* G = &gGlyphCache;
+    for (int i = 0; i < count; ++i)
+    {
+        u16* entry = mapEntry(&image[i], gridFont);
+        if (entry && isSlot(*entry))
+        {
+            int slot = *entry - GLYPH_MAP_FONT_GLYPHS;
+            if (!glyphSlotsUsedNow(&G->slots, slot)) glyphSlotsTouch(&G->slots, slot);
+        }
+    }
+    G->scanned = YES;
+    ++G->stats.scans;
+}
+
+// Point a slot's map entry back at nothing.
+internal void forgetSlot(int slot)
+{
+    GlyphCache* G = &gGlyphCache;
+    const GlyphSlot* s = &G->slots.slots[slot];
+    G->map[(i64)s->font * GLYPH_MAP_SIZE + s->codepoint] = 0;
+    uploadMapEntry(s->font, s->codepoint, 0);
+}
+
+// Double the number of slots, keeping the glyphs already cached.
+internal bool growCache()
+{
+    GlyphCache* G = &gGlyphCache;
+    int oldSlots = G->slots.numSlots;
+    if (!glyphSlotsGrow(&G->slots)) return NO;
+
+    int newSlots = G->slots.numSlots;
+    G->glyphs = K_REALLOC(G->glyphs, (i64)oldSlots * G->rows * sizeof(u32), (i64)newSlots * G->rows * sizeof(u32));
+    memoryClear(G->glyphs + (i64)oldSlots * G->rows, (i64)(newSlots - oldSlots) * G->rows * sizeof(u32));
+    allocGlyphTexture();
+    ++G->stats.grows;
+    return YES;
+}
+
+// Find a slot for a new glyph: a free one, the least recently used one that isn't on screen, or a new one.  Returns 0
+// only if every slot is on screen and the cache can't grow.
+internal int allocSlot(const Cell* image, int count, int gridFont)
+{
+    GlyphCache* G = &gGlyphCache;
+    int slot = glyphSlotsTake(&G->slots);
+    if (slot) return slot;
+
+    if (!G->scanned) scanImage(image, count, gridFont);
+    slot = glyphSlotsEvict(&G->slots);
+    if (slot)
+    {
+        forgetSlot(slot);
+        ++G->stats.evictions;
+        return slot;
+    }
+
+    return growCache() ? glyphSlotsTake(&G->slots) : 0;
+}
+
+internal void lookup(const Cell* cell, const Cell* image, int count, int gridFont)
+{
+    GlyphCache* G = &gGlyphCache;
+    u16* entry = mapEntry(cell, gridFont);
+    ++G->stats.lookups;
+    if (!entry) return;
+
+    if (*entry)
+    {
+        ++G->stats.hits;
+        if (isSlot(*entry)) glyphSlotsTouch(&G->slots, *entry - GLYPH_MAP_FONT_GLYPHS);
+        return;
+    }
+
+    // A font that hasn't loaded yet is drawn blank; its glyphs are flushed when it arrives.
+    ++G->stats.misses;
+    int font = cellFont(cell, gridFont);
+    const RasterFont* raster = &G->fonts[font];
+    if (!raster->masks) return;
+
+    int slot = allocSlot(image, count, gridFont);
+    if (!slot)
+    {
+        if (!G->stats.overflows) prn("Glyph cache: full at %d slots, drawing glyphs blank", G->slots.numSlots);
+        ++G->stats.overflows;
+        return;
+    }
+
+    TimePoint t0 = timeNow();
+    u32* glyph = G->glyphs + (i64)slot * G->rows;
+    memoryClear(glyph, G->rows * sizeof(u32));
+    rasterSynthGlyph(cell->codepoint, raster->width, K_MIN(raster->height, G->rows), glyph);
+    uploadSlot(slot);
+    *entry = (u16)(slot + GLYPH_MAP_FONT_GLYPHS);
+    uploadMapEntry(font, cell->codepoint, *entry);
+    G->stats.uploadTime += timeToSecs(timePeriod(t0, timeNow()));
+    ++G->stats.uploads;
+
+    glyphSlotsUse(&G->slots, slot, cell->codepoint, font);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Interface
+//----------------------------------------------------------------------------------------------------------------------
+
+void glyphCacheInit(const RasterFont* fonts, int numFonts, int rows, int numGlyphs)
+{
+    GlyphCache* G = &gGlyphCache;
+    memoryClear(G, sizeof(*G));
+    G->fonts = fonts;
+    G->numFonts = numFonts;
+    G->rows = K_MAX(rows, 1);
+
+    // Each slot is a row of the cache texture, so there can't be more than the driver's largest texture allows.
+    GLint maxSize = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize);
+    glyphSlotsInit(&G->slots, numGlyphs + 1, K_MIN(GLYPH_CACHE_MAX_SLOTS, maxSize));
+    if (G->slots.numSlots - 1 != numGlyphs)
+    {
+        prn("Glyph cache: room for %d glyphs asked for, using %d", numGlyphs, G->slots.numSlots - 1);
+    }
+    G->map = K_ALLOC((i64)numFonts * GLYPH_MAP_SIZE * sizeof(u16));
+    G->glyphs = K_ALLOC_CLEAR((i64)G->slots.numSlots * G->rows * sizeof(u32));
+
+    glGenTextures(1, &G->glyphTex);
+    glGenTextures(1, &G->mapTex);
+
+    glActiveTexture(GL_TEXTURE4);
+    glBindTexture(GL_TEXTURE_2D, G->glyphTex);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    allocGlyphTexture();
+
+    glActiveTexture(GL_TEXTURE2);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, G->mapTex);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_R16UI, 256, GLYPH_MAP_SIZE / 256, numFonts, 0, GL_RED_INTEGER,
+        GL_UNSIGNED_SHORT, NULL);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glActiveTexture(GL_TEXTURE1);
+
+    initMap();
+}
+
+void glyphCacheDone()
+{
+    GlyphCache* G = &gGlyphCache;
+    glDeleteTextures(1, &G->glyphTex);
+    glDeleteTextures(1, &G->mapTex);
+    K_FREE(G->glyphs, (i64)G->slots.numSlots * G->rows * sizeof(u32));
+    K_FREE(G->map, (i64)G->numFonts * GLYPH_MAP_SIZE * sizeof(u16));
+    glyphSlotsDone(&G->slots);
+    memoryClear(G, sizeof(*G));
+}
+
+void glyphCacheFlush(int font)
+{
+    GlyphCache* G = &gGlyphCache;
+    int slot = G->slots.head;
+    while (slot)
+    {
+        int next = G->slots.slots[slot].next;
+        if (G->slots.slots[slot].font == font)
+        {
+            forgetSlot(slot);
+            glyphSlotsRelease(&G->slots, slot);
+        }
+        slot = next;
+    }
+}
+
+void glyphCacheUpdate(const Cell* image, int width, int height, const Damage* damage, int gridFont)
+{
+    GlyphCache* G = &gGlyphCache;
+    glyphSlotsBeginUpdate(&G->slots);
+    G->scanned = NO;
+
+    for (int i = 0; i < damage->count; ++i)
+    {
+        const DamageRect* r = &damage->rects[i];
+        for (int y = r->y; y < r->y + r->h; ++y)
+        {
+            const Cell* row = image + (i64)y * width;
+            for (int x = r->x; x < r->x + r->w; ++x) lookup(&row[x], image, width * height, gridFont);
+        }
+    }
+}
+
+const GlyphCacheStats* glyphCacheStats()
+{
+    return &gGlyphCache.stats;
+}
+
+void glyphCacheReport()
+{
+    const GlyphCache* G = &gGlyphCache;
+    const GlyphCacheStats* s = &G->stats;
+    prn("Glyph cache: %llu lookups, %.2f%% hits, %llu misses, %llu evictions, %llu overflows, %llu scans, "
+        "%d slots after %llu grows", (unsigned long long)s->lookups,
+        s->lookups ? (f64)s->hits * 100.0 / (f64)s->lookups : 100.0, (unsigned long long)s->misses,
+        (unsigned long long)s->evictions, (unsigned long long)s->overflows, (unsigned long long)s->scans,
+        G->slots.numSlots - 1, (unsigned long long)s->grows);
+    prn("Glyph cache: %llu glyphs uploaded, %llu bytes in total, %.3fms issuing glyph uploads",
+        (unsigned long long)s->uploads, (unsigned long long)s->uploadBytes, s->uploadTime * 1000.0);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
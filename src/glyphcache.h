@@ -0,0 +1,71 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       glyphcache.h
+//! @brief      GPU cache of the glyphs the fonts don't have, filled on demand.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <glyphslots.h>
+#include <raster.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// Cells hold Unicode codepoints.  The fonts' code page 437 glyphs are always on the GPU, in the font texture array
+// (see main.c), so only the glyphs drawn to fit each font by rasterSynthGlyph() need caching.  They are kept in a
+// GL_R32UI texture with one texel per glyph row (bit x set if pixel x is lit), one row of texels per slot.
+//
+// A GL_R16UI map, one 256 x 256 layer per font, says where the glyph of each (codepoint, font) is: 0 if it is blank
+// or not cached, 1 to GLYPH_MAP_FONT_GLYPHS for glyph entry - 1 of the font, and above that cache slot
+// entry - GLYPH_MAP_FONT_GLYPHS.  So the shaders find any glyph with two fetches and the cells are uploaded as they
+// are.  The map covers the Basic Multilingual Plane; codepoints beyond it are drawn blank.
+//
+// Whenever cells are uploaded, glyphCacheUpdate() looks up the glyphs of the damaged ones.  A synthesized glyph that
+// isn't cached is drawn into a free slot.  When there are none left, the least recently used glyph is evicted if it
+// isn't on screen, which the whole image is scanned once to find out; otherwise the cache doubles in size.  Every
+// synthesized glyph of every font fits in GLYPH_CACHE_MAX_SLOTS, so a glyph is never left blank for want of room.
+//----------------------------------------------------------------------------------------------------------------------
+
+#define GLYPH_CACHE_GLYPHS      256         // Default number of glyphs to start with
+#define GLYPH_MAP_FONT_GLYPHS   256         // Map entries up to this are font glyphs; above it, cache slots
+#define GLYPH_CACHE_MAX_SLOTS   (0xffff - GLYPH_MAP_FONT_GLYPHS)    // Map entries are 16 bits, and 0xffff is reserved
+#define GLYPH_MAP_SIZE          0x10000     // Codepoints covered by the map
+
+STRUCT_START(GlyphCacheStats)
+{
+    u64     lookups;        // Damaged cells looked up
+    u64     hits;           // In a font, in the cache, or known to have no glyph
+    u64     misses;
+    u64     evictions;
+    u64     grows;          // Times the cache doubled in size
+    u64     overflows;      // Misses that couldn't be cached at all (only if the texture can't grow big enough)
+    u64     scans;          // Scans of the whole image for glyphs on screen
+    u64     uploads;        // Glyphs drawn into the cache
+    u64     uploadBytes;    // Including the map texels
+    f64     uploadTime;     // Seconds spent issuing the uploads
+}
+STRUCT_END(GlyphCacheStats);
+
+// Create the map and the cache, bound to texture units 2 and 4.  The map's font glyph entries are filled in here and
+// never change.  Glyphs are synthesized to the size of fonts, which must outlive the cache; a font that isn't loaded
+// has no masks and its cells are drawn blank.  Each slot holds rows glyph rows, enough for the tallest font.  The
+// cache starts with room for numGlyphs glyphs and grows up to GLYPH_CACHE_MAX_SLOTS slots, or as many as fit in
+// GL_MAX_TEXTURE_SIZE.
+void glyphCacheInit(const RasterFont* fonts, int numFonts, int rows, int numGlyphs);
+void glyphCacheDone();
+
+// Forget the cached glyphs of a font, after it has been loaded or replaced.  All the cells on screen must be passed to
+// glyphCacheUpdate() again.
+void glyphCacheFlush(int font);
+
+// Make the glyphs of the damaged cells of an image resident, resolving CELL_FONT_GRID to gridFont.  The whole image
+// may be scanned for glyphs still on screen, so it must be ordinary memory holding every cell on screen, never a
+// write-only buffer mapping.
+void glyphCacheUpdate(const Cell* image, int width, int height, const Damage* damage, int gridFont);
+
+const GlyphCacheStats* glyphCacheStats();
+
+// Print the statistics.
+void glyphCacheReport();
+
+//----------------------------------------------------------------------------------------------------------------------
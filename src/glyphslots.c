@@ -0,0 +1,116 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       glyphslots.c
+//! @brief      Least recently used slots for the glyph cache.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <glyphslots.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// LRU list
+//----------------------------------------------------------------------------------------------------------------------
+
+internal void lruUnlink(GlyphSlots* S, int slot)
+{
+    GlyphSlot* s = &S->slots[slot];
+    if (s->prev) S->slots[s->prev].next = s->next; else S->head = s->next;
+    if (s->next) S->slots[s->next].prev = s->prev; else S->tail = s->prev;
+    s->prev = 0;
+    s->next = 0;
+}
+
+internal void lruPushFront(GlyphSlots* S, int slot)
+{
+    GlyphSlot* s = &S->slots[slot];
+    s->prev = 0;
+    s->next = S->head;
+    if (S->head) S->slots[S->head].prev = slot; else S->tail = slot;
+    S->head = slot;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Interface
+//----------------------------------------------------------------------------------------------------------------------
+
+void glyphSlotsInit(GlyphSlots* S, int numSlots, int maxSlots)
+{
+    memoryClear(S, sizeof(*S));
+    S->maxSlots = K_MAX(maxSlots, 2);
+    S->numSlots = K_MAX(2, K_MIN(numSlots, S->maxSlots));
+    S->slots = K_ALLOC_CLEAR(S->numSlots * sizeof(GlyphSlot));
+}
+
+void glyphSlotsDone(GlyphSlots* S)
+{
+    K_FREE(S->slots, S->numSlots * sizeof(GlyphSlot));
+    memoryClear(S, sizeof(*S));
+}
+
+void glyphSlotsBeginUpdate(GlyphSlots* S)
+{
+    ++S->update;
+}
+
+void glyphSlotsTouch(GlyphSlots* S, int slot)
+{
+    S->slots[slot].lastUse = S->update;
+    if (S->head != slot)
+    {
+        lruUnlink(S, slot);
+        lruPushFront(S, slot);
+    }
+}
+
+bool glyphSlotsUsedNow(const GlyphSlots* S, int slot)
+{
+    return S->slots[slot].lastUse == S->update;
+}
+
+int glyphSlotsTake(GlyphSlots* S)
+{
+    if (S->released)
+    {
+        int slot = S->released;
+        S->released = S->slots[slot].next;
+        S->slots[slot].next = 0;
+        return slot;
+    }
+    return S->numUsed < S->numSlots - 1 ? ++S->numUsed : 0;
+}
+
+int glyphSlotsEvict(GlyphSlots* S)
+{
+    int slot = S->tail;
+    if (!slot || glyphSlotsUsedNow(S, slot)) return 0;
+    lruUnlink(S, slot);
+    return slot;
+}
+
+bool glyphSlotsGrow(GlyphSlots* S)
+{
+    if (S->numSlots >= S->maxSlots) return NO;
+    int newSlots = K_MIN(S->numSlots * 2, S->maxSlots);
+    S->slots = K_REALLOC(S->slots, S->numSlots * sizeof(GlyphSlot), newSlots * sizeof(GlyphSlot));
+    memoryClear(S->slots + S->numSlots, (newSlots - S->numSlots) * sizeof(GlyphSlot));
+    S->numSlots = newSlots;
+    return YES;
+}
+
+void glyphSlotsUse(GlyphSlots* S, int slot, u32 codepoint, int font)
+{
+    GlyphSlot* s = &S->slots[slot];
+    s->codepoint = codepoint;
+    s->font = font;
+    s->lastUse = S->update;
+    lruPushFront(S, slot);
+}
+
+void glyphSlotsRelease(GlyphSlots* S, int slot)
+{
+    lruUnlink(S, slot);
+    S->slots[slot].next = S->released;
+    S->released = slot;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,74 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       glyphslots.h
+//! @brief      Least recently used slots for the glyph cache.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <game.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// The bookkeeping behind the glyph cache (see glyphcache.h), kept apart from the textures.  Slots are numbered from 1;
+// slot 0 is never handed out, so 0 means none.  Slots in use are kept on a list from the most to the least recently
+// used, and each remembers the update in which it was last used so that the glyphs still on screen can be told apart
+// from those that are free to go.
+//
+// A new glyph takes a slot that has never been used or that was released, then the least recently used slot if it
+// wasn't used during this update, and only then grows the slots.  So nothing on screen is ever evicted.
+//----------------------------------------------------------------------------------------------------------------------
+
+STRUCT_START(GlyphSlot)
+{
+    u32     codepoint;
+    int     font;
+    u32     lastUse;        // Update in which the glyph was last used
+    int     prev;           // Neighbours in the LRU list: towards the most recently used
+    int     next;           // and towards the least recently used.  Also links the released slots.
+}
+STRUCT_END(GlyphSlot);
+
+STRUCT_START(GlyphSlots)
+{
+    GlyphSlot*  slots;
+    int         numSlots;       // Including slot 0
+    int         maxSlots;       // Most that numSlots can grow to
+    int         numUsed;        // Slots 1 to numUsed have been handed out at some time
+    int         released;       // First of the released slots
+    int         head;           // Most recently used slot
+    int         tail;           // Least recently used slot
+    u32         update;
+}
+STRUCT_END(GlyphSlots);
+
+// numSlots and maxSlots include slot 0, and numSlots is clamped to between 2 and maxSlots.
+void glyphSlotsInit(GlyphSlots* S, int numSlots, int maxSlots);
+void glyphSlotsDone(GlyphSlots* S);
+
+// Start a new update: the slots used from now on are protected from eviction until the next one.
+void glyphSlotsBeginUpdate(GlyphSlots* S);
+
+// Mark a slot in use as used during this update.
+void glyphSlotsTouch(GlyphSlots* S, int slot);
+
+// Returns YES if a slot was used during this update.
+bool glyphSlotsUsedNow(const GlyphSlots* S, int slot);
+
+// Take a slot that is not in use, or return 0 if there are none.
+int glyphSlotsTake(GlyphSlots* S);
+
+// Take the least recently used slot if it wasn't used during this update, or return 0.  Its codepoint and font are
+// left in it so the caller can forget the glyph that was there.
+int glyphSlotsEvict(GlyphSlots* S);
+
+// Double the number of slots, up to maxSlots.  Returns NO if there are already maxSlots.
+bool glyphSlotsGrow(GlyphSlots* S);
+
+// Put a glyph in a slot taken with one of the above, as the most recently used.
+void glyphSlotsUse(GlyphSlots* S, int slot, u32 codepoint, int font);
+
+// Give back a slot in use.
+void glyphSlotsRelease(GlyphSlots* S, int slot);
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,100 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       headless.c
+//! @brief      Window-less OpenGL contexts for offscreen rendering.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <headless.h>
+
+#if defined(_WIN32)
+
+//----------------------------------------------------------------------------------------------------------------------
+// Windows: WGL always needs a window, so there is no headless context.
+//----------------------------------------------------------------------------------------------------------------------
+
+bool headlessInit()
+{
+    return NO;
+}
+
+void headlessDone()
+{
+}
+
+#else
+
+#include <kore/kgl.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// Linux: surfaceless EGL
+//----------------------------------------------------------------------------------------------------------------------
+
+internal EGLDisplay gHeadlessDisplay = EGL_NO_DISPLAY;
+internal EGLContext gHeadlessContext = EGL_NO_CONTEXT;
+internal GLuint gHeadlessVao = 0;
+
+bool headlessInit()
+{
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+        (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    if (!getPlatformDisplay)
+    {
+        prn("Headless: EGL_EXT_platform_base is not supported");
+        return NO;
+    }
+
+    gHeadlessDisplay = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+    if (gHeadlessDisplay == EGL_NO_DISPLAY || !eglInitialize(gHeadlessDisplay, NULL, NULL))
+    {
+        prn("Headless: unable to initialise a surfaceless EGL display");
+        return NO;
+    }
+
+    static const EGLint contextAttribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION,          4,
+        EGL_CONTEXT_MINOR_VERSION,          5,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK,    EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+
+    eglBindAPI(EGL_OPENGL_API);
+    gHeadlessContext = eglCreateContext(gHeadlessDisplay, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, contextAttribs);
+    if (gHeadlessContext == EGL_NO_CONTEXT ||
+        !eglMakeCurrent(gHeadlessDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, gHeadlessContext))
+    {
+        prn("Headless: unable to create an OpenGL 4.5 context (EGL error 0x%x)", eglGetError());
+        headlessDone();
+        return NO;
+    }
+
+    // Core profiles have no default vertex array object.
+    glGenVertexArrays(1, &gHeadlessVao);
+    glBindVertexArray(gHeadlessVao);
+
+    prn("Headless: %s (%s)", glGetString(GL_RENDERER), glGetString(GL_VERSION));
+    return YES;
+}
+
+void headlessDone()
+{
+    if (gHeadlessVao)
+    {
+        glDeleteVertexArrays(1, &gHeadlessVao);
+        gHeadlessVao = 0;
+    }
+    if (gHeadlessDisplay != EGL_NO_DISPLAY)
+    {
+        eglMakeCurrent(gHeadlessDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (gHeadlessContext != EGL_NO_CONTEXT) eglDestroyContext(gHeadlessDisplay, gHeadlessContext);
+        eglTerminate(gHeadlessDisplay);
+    }
+    gHeadlessDisplay = EGL_NO_DISPLAY;
+    gHeadlessContext = EGL_NO_CONTEXT;
+}
+
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,22 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       headless.h
+//! @brief      Window-less OpenGL contexts for offscreen rendering.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <kore/kore.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// On Linux this creates a surfaceless EGL context (EGL_MESA_platform_surfaceless), which works without a display
+// server and with Mesa's software rasterizer (set LIBGL_ALWAYS_SOFTWARE=1 to force llvmpipe).  There is no default
+// framebuffer, so all rendering must go to a framebuffer object.  Elsewhere headlessInit() fails and the caller should
+// fall back to a window's context.
+//----------------------------------------------------------------------------------------------------------------------
+
+bool headlessInit();
+void headlessDone();
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,105 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       idle.c
+//! @brief      Sleeping the main loop until there is something to do.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <idle.h>
+
+#if defined(_WIN32)
+
+#include <windows.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// Windows
+//----------------------------------------------------------------------------------------------------------------------
+
+internal DWORD idleMilliseconds(f64 seconds)
+{
+    return seconds < 0.0 ? INFINITE : (DWORD)(seconds * 1000.0 + 0.5);
+}
+
+// Auto-reset event signalled by idleWake(), created by whichever thread needs it first.
+internal HANDLE idleEvent()
+{
+    static HANDLE event = NULL;
+    if (!event)
+    {
+        HANDLE newEvent = CreateEventA(NULL, FALSE, FALSE, NULL);
+        if (InterlockedCompareExchangePointer(&event, newEvent, NULL) != NULL) CloseHandle(newEvent);
+    }
+    return event;
+}
+
+void idleWait(f64 timeout)
+{
+    // MWMO_INPUTAVAILABLE also wakes for messages that are already queued but were seen by an earlier peek.
+    HANDLE event = idleEvent();
+    MsgWaitForMultipleObjectsEx(1, &event, idleMilliseconds(timeout), QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+}
+
+void idleWake()
+{
+    SetEvent(idleEvent());
+}
+
+void idleSleep(f64 seconds)
+{
+    if (seconds > 0.0) Sleep(idleMilliseconds(seconds));
+}
+
+#else
+
+#include <pthread.h>
+#include <time.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// Others
+//----------------------------------------------------------------------------------------------------------------------
+
+internal pthread_mutex_t gIdleLock = PTHREAD_MUTEX_INITIALIZER;
+internal pthread_cond_t gIdleCond = PTHREAD_COND_INITIALIZER;
+internal bool gIdleWoken = NO;
+
+void idleSleep(f64 seconds)
+{
+    if (seconds <= 0.0) return;
+
+    struct timespec ts;
+    ts.tv_sec = (time_t)seconds;
+    ts.tv_nsec = (long)((seconds - (f64)ts.tv_sec) * 1000000000.0);
+    nanosleep(&ts, NULL);
+}
+
+void idleWait(f64 timeout)
+{
+    f64 seconds = (timeout < 0.0 || timeout > IDLE_POLL_SLICE) ? IDLE_POLL_SLICE : timeout;
+
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_sec += (time_t)seconds;
+    ts.tv_nsec += (long)((seconds - (f64)(time_t)seconds) * 1000000000.0);
+    if (ts.tv_nsec >= 1000000000)
+    {
+        ts.tv_sec += 1;
+        ts.tv_nsec -= 1000000000;
+    }
+
+    pthread_mutex_lock(&gIdleLock);
+    while (!gIdleWoken && pthread_cond_timedwait(&gIdleCond, &gIdleLock, &ts) == 0) {}
+    gIdleWoken = NO;
+    pthread_mutex_unlock(&gIdleLock);
+}
+
+void idleWake()
+{
+    pthread_mutex_lock(&gIdleLock);
+    gIdleWoken = YES;
+    pthread_cond_signal(&gIdleCond);
+    pthread_mutex_unlock(&gIdleLock);
+}
+
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,32 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       idle.h
+//! @brief      Sleeping the main loop until there is something to do.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <kore/kore.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// On Windows idleWait() blocks on the thread's message queue, so it returns as soon as any window message arrives.
+// Elsewhere the window system's queue isn't visible from here, so it sleeps in slices of IDLE_POLL_SLICE seconds and
+// the caller polls for input between them.
+//
+// Other threads call idleWake() to end the main thread's current (or next) idleWait() early, for example when a
+// background load has finished.
+//----------------------------------------------------------------------------------------------------------------------
+
+#define IDLE_POLL_SLICE     0.01
+
+// Sleep until window input arrives or timeout seconds have passed.  A negative timeout waits for input only.
+void idleWait(f64 timeout);
+
+// Wake the main thread from idleWait().  Can be called from any thread.
+void idleWake();
+
+// Sleep for a number of seconds regardless of input.
+void idleSleep(f64 seconds);
+
+//----------------------------------------------------------------------------------------------------------------------
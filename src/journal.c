@@ -0,0 +1,174 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       journal.c
+//! @brief      Append-only undo journal of cell changes.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <journal.h>
+
+#include <string.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// Storage
+//----------------------------------------------------------------------------------------------------------------------
+
+// Return the page holding the given entry, allocating pages from the pool as needed.
+internal void* journalPage(PageTable* table, Pool* pool, int index)
+{
+    int page = index >> JOURNAL_PAGE_SHIFT;
+    while (page >= table->numPages)
+    {
+        if (table->numPages == table->maxPages)
+        {
+            int newMax = K_MAX(16, table->maxPages * 2);
+            table->pages = K_REALLOC(table->pages, table->maxPages * sizeof(void*), newMax * sizeof(void*));
+            table->maxPages = newMax;
+        }
+        table->pages[table->numPages++] = poolAlloc(pool);
+    }
+    return table->pages[page];
+}
+
+// Give back every page that holds no entries once the table is cut down to count entries.
+internal void journalTrim(PageTable* table, Pool* pool, int count)
+{
+    int needed = (count + JOURNAL_PAGE_MASK) >> JOURNAL_PAGE_SHIFT;
+    while (table->numPages > needed)
+    {
+        poolFree(pool, table->pages[--table->numPages]);
+    }
+}
+
+internal Delta* journalDelta(const Journal* journal, int index)
+{
+    return &((Delta *)journal->deltas.pages[index >> JOURNAL_PAGE_SHIFT])[index & JOURNAL_PAGE_MASK];
+}
+
+internal int journalCommand(const Journal* journal, int index)
+{
+    return ((int *)journal->commands.pages[index >> JOURNAL_PAGE_SHIFT])[index & JOURNAL_PAGE_MASK];
+}
+
+internal Delta* journalNewDelta(Journal* journal)
+{
+    Delta* page = journalPage(&journal->deltas, &journal->deltaPool, journal->numDeltas);
+    return &page[journal->numDeltas++ & JOURNAL_PAGE_MASK];
+}
+
+// Return the range of deltas [start, end) that make up a command.
+internal void journalCommandRange(const Journal* journal, int cmd, int* start, int* end)
+{
+    *start = journalCommand(journal, cmd);
+    *end = (cmd + 1 < journal->numCommands) ? journalCommand(journal, cmd + 1) : journal->numDeltas;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Lifetime
+//----------------------------------------------------------------------------------------------------------------------
+
+void journalInit(Journal* journal)
+{
+    memoryClear(journal, sizeof(Journal));
+    poolInit(&journal->deltaPool, JOURNAL_PAGE_SIZE * sizeof(Delta), 16);
+    poolInit(&journal->commandPool, JOURNAL_PAGE_SIZE * sizeof(int), 16);
+}
+
+void journalDone(Journal* journal)
+{
+    poolDone(&journal->deltaPool);
+    poolDone(&journal->commandPool);
+    K_FREE(journal->deltas.pages, journal->deltas.maxPages * sizeof(void*));
+    K_FREE(journal->commands.pages, journal->commands.maxPages * sizeof(void*));
+    journalInit(journal);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Recording
+//----------------------------------------------------------------------------------------------------------------------
+
+void journalBegin(Journal* journal)
+{
+    // Drop the redo history.
+    if (journal->cmdIndex < journal->numCommands)
+    {
+        journal->numDeltas = journalCommand(journal, journal->cmdIndex);
+        journal->numCommands = journal->cmdIndex;
+        journalTrim(&journal->deltas, &journal->deltaPool, journal->numDeltas);
+        journalTrim(&journal->commands, &journal->commandPool, journal->numCommands);
+    }
+
+    int* page = journalPage(&journal->commands, &journal->commandPool, journal->numCommands);
+    page[journal->numCommands++ & JOURNAL_PAGE_MASK] = journal->numDeltas;
+    journal->cmdIndex = journal->numCommands;
+}
+
+bool journalIsOpen(const Journal* journal)
+{
+    return journal->numCommands > 0 && journal->cmdIndex == journal->numCommands;
+}
+
+void journalApply(Journal* journal, Canvas* canvas, int x, int y, int w, int h, const Cell* cells)
+{
+    for (int row = 0; row < h; ++row)
+    {
+        for (int col = 0; col < w; ++col)
+        {
+            Cell before = canvasGet(canvas, x + col, y + row);
+            Cell after = cells[row * w + col];
+            if (memcmp(&before, &after, sizeof(Cell)) != 0)
+            {
+                Delta* d = journalNewDelta(journal);
+                d->x = x + col;
+                d->y = y + row;
+                d->before = before;
+                d->after = after;
+            }
+        }
+    }
+
+    canvasWrite(canvas, x, y, w, h, cells, w);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Replay
+//----------------------------------------------------------------------------------------------------------------------
+
+const Delta* journalUndo(Journal* journal, Canvas* canvas)
+{
+    const Delta* last = 0;
+    int start, end;
+
+    while (journal->cmdIndex > 0 && !last)
+    {
+        // Empty commands are skipped so that every undo has a visible effect.
+        journalCommandRange(journal, --journal->cmdIndex, &start, &end);
+        for (int i = end - 1; i >= start; --i)
+        {
+            last = journalDelta(journal, i);
+            canvasWrite(canvas, last->x, last->y, 1, 1, &last->before, 1);
+        }
+    }
+
+    return last;
+}
+
+const Delta* journalRedo(Journal* journal, Canvas* canvas)
+{
+    const Delta* last = 0;
+    int start, end;
+
+    while (journal->cmdIndex < journal->numCommands && !last)
+    {
+        journalCommandRange(journal, journal->cmdIndex++, &start, &end);
+        for (int i = start; i < end; ++i)
+        {
+            last = journalDelta(journal, i);
+            canvasWrite(canvas, last->x, last->y, 1, 1, &last->after, 1);
+        }
+    }
+
+    return last;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,73 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       journal.h
+//! @brief      Append-only undo journal of cell changes.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <canvas.h>
+#include <pool.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// Every change to the canvas is recorded as a delta (position, old cell, new cell) in one contiguous buffer.  A command
+// is a consecutive run of deltas, identified by the index of its first delta.  Undo replays a command's deltas
+// backwards writing the old cells, redo replays them forwards writing the new ones.
+//
+// Deltas and command indices are stored in fixed-size pages drawn from two pools (one per size class), so recording
+// never copies existing history and dropping the redo history hands whole pages back to the pools.
+//----------------------------------------------------------------------------------------------------------------------
+
+#define JOURNAL_PAGE_SHIFT  10
+#define JOURNAL_PAGE_SIZE   (1 << JOURNAL_PAGE_SHIFT)
+#define JOURNAL_PAGE_MASK   (JOURNAL_PAGE_SIZE - 1)
+
+STRUCT_START(Delta)
+{
+    int     x, y;
+    Cell    before;
+    Cell    after;
+}
+STRUCT_END(Delta);
+
+// A growable array stored as a table of fixed-size pages.
+STRUCT_START(PageTable)
+{
+    void**  pages;
+    int     numPages;
+    int     maxPages;
+}
+STRUCT_END(PageTable);
+
+STRUCT_START(Journal)
+{
+    Pool        deltaPool;      // Pages of JOURNAL_PAGE_SIZE deltas
+    Pool        commandPool;    // Pages of JOURNAL_PAGE_SIZE command indices
+    PageTable   deltas;         // All recorded deltas in order
+    PageTable   commands;       // Index of the first delta of each command
+    int         numDeltas;
+    int         numCommands;
+    int         cmdIndex;       // Number of commands currently applied to the canvas
+}
+STRUCT_END(Journal);
+
+void journalInit(Journal* journal);
+void journalDone(Journal* journal);
+
+// Start a new command.  Any commands that were undone are discarded.
+void journalBegin(Journal* journal);
+
+// Returns YES if the last command is still the current one (nothing has been undone since), so journalApply will extend
+// it.
+bool journalIsOpen(const Journal* journal);
+
+// Write the rectangle of cells to the canvas as part of the current command, recording a delta for every cell that
+// changes.
+void journalApply(Journal* journal, Canvas* canvas, int x, int y, int w, int h, const Cell* cells);
+
+// Undo or redo a whole command.  Return the delta that was applied last, or 0 if there was nothing to do.
+const Delta* journalUndo(Journal* journal, Canvas* canvas);
+const Delta* journalRedo(Journal* journal, Canvas* canvas);
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,233 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       loader.c
+//! @brief      Loading assets on a background thread.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <loader.h>
+#include <idle.h>
+
+#define LOADER_MAX_JOBS     32
+
+STRUCT_START(LoadJob)
+{
+    LoadFunc    load;
+    LoadFunc    ready;
+    void*       data;
+}
+STRUCT_END(LoadJob);
+
+//----------------------------------------------------------------------------------------------------------------------
+// Threads
+//----------------------------------------------------------------------------------------------------------------------
+
+#if defined(_WIN32)
+
+#include <windows.h>
+
+typedef HANDLE Thread;
+typedef SRWLOCK Lock;
+typedef CONDITION_VARIABLE Signal;
+
+internal void lockInit(Lock* lock)              { InitializeSRWLock(lock); }
+internal void lockDone(Lock* lock)              { (void)lock; }
+internal void lockEnter(Lock* lock)             { AcquireSRWLockExclusive(lock); }
+internal void lockLeave(Lock* lock)             { ReleaseSRWLockExclusive(lock); }
+internal void signalInit(Signal* signal)        { InitializeConditionVariable(signal); }
+internal void signalDone(Signal* signal)        { (void)signal; }
+internal void signalWait(Signal* s, Lock* lock) { SleepConditionVariableSRW(s, lock, INFINITE, 0); }
+internal void signalWake(Signal* signal)        { WakeAllConditionVariable(signal); }
+
+internal DWORD WINAPI loaderThread(LPVOID param);
+
+internal bool threadStart(Thread* thread)
+{
+    *thread = CreateThread(NULL, 0, &loaderThread, NULL, 0, NULL);
+    return *thread != NULL;
+}
+
+internal void threadJoin(Thread* thread)
+{
+    WaitForSingleObject(*thread, INFINITE);
+    CloseHandle(*thread);
+}
+
+#else
+
+#include <pthread.h>
+
+typedef pthread_t Thread;
+typedef pthread_mutex_t Lock;
+typedef pthread_cond_t Signal;
+
+internal void lockInit(Lock* lock)              { pthread_mutex_init(lock, NULL); }
+internal void lockDone(Lock* lock)              { pthread_mutex_destroy(lock); }
+internal void lockEnter(Lock* lock)             { pthread_mutex_lock(lock); }
+internal void lockLeave(Lock* lock)             { pthread_mutex_unlock(lock); }
+internal void signalInit(Signal* signal)        { pthread_cond_init(signal, NULL); }
+internal void signalDone(Signal* signal)        { pthread_cond_destroy(signal); }
+internal void signalWait(Signal* s, Lock* lock) { pthread_cond_wait(s, lock); }
+internal void signalWake(Signal* signal)        { pthread_cond_broadcast(signal); }
+
+internal void* loaderThread(void* param);
+
+internal bool threadStart(Thread* thread)       { return pthread_create(thread, NULL, &loaderThread, NULL) == 0; }
+internal void threadJoin(Thread* thread)        { pthread_join(*thread, NULL); }
+
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+// Job queue
+//----------------------------------------------------------------------------------------------------------------------
+
+// Jobs live in a ring.  The counters only ever increase: jobs [numReady, numLoaded) are loaded and waiting for
+// loaderPoll(), and jobs [numLoaded, numQueued) are waiting for the worker.
+STRUCT_START(Loader)
+{
+    LoadJob     jobs[LOADER_MAX_JOBS];
+    int         numQueued;
+    int         numLoaded;
+    int         numReady;
+    bool        quit;
+    bool        running;
+
+    Thread      thread;
+    Lock        lock;
+    Signal      changed;        // A job was queued or loaded, or the worker should quit
+}
+STRUCT_END(Loader);
+
+internal Loader gLoader;
+
+#if defined(_WIN32)
+internal DWORD WINAPI loaderThread(LPVOID param)
+#else
+internal void* loaderThread(void* param)
+#endif
+{
+    (void)param;
+    Loader* L = &gLoader;
+
+    lockEnter(&L->lock);
+    for (;;)
+    {
+        while (!L->quit && L->numLoaded == L->numQueued) signalWait(&L->changed, &L->lock);
+        if (L->quit) break;
+
+        LoadJob job = L->jobs[L->numLoaded % LOADER_MAX_JOBS];
+        lockLeave(&L->lock);
+        job.load(job.data);
+        lockEnter(&L->lock);
+
+        ++L->numLoaded;
+        signalWake(&L->changed);
+        idleWake();
+    }
+    lockLeave(&L->lock);
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void loaderInit()
+{
+    Loader* L = &gLoader;
+    memoryClear(L, sizeof(*L));
+    lockInit(&L->lock);
+    signalInit(&L->changed);
+
+    // If there's no thread, jobs are loaded as they are queued.
+    L->running = threadStart(&L->thread);
+    if (!L->running)
+    {
+        signalDone(&L->changed);
+        lockDone(&L->lock);
+    }
+}
+
+void loaderDone()
+{
+    Loader* L = &gLoader;
+    if (!L->running) return;
+
+    // Jobs still being loaded are finished so that their data can be released by their ready functions.
+    loaderFinish();
+
+    lockEnter(&L->lock);
+    L->quit = YES;
+    signalWake(&L->changed);
+    lockLeave(&L->lock);
+
+    threadJoin(&L->thread);
+    signalDone(&L->changed);
+    lockDone(&L->lock);
+    L->running = NO;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void loaderQueue(LoadFunc load, LoadFunc ready, void* data)
+{
+    Loader* L = &gLoader;
+
+    // Without a worker, or with a full ring, load on the calling thread.
+    if (!L->running || L->numQueued - L->numReady == LOADER_MAX_JOBS)
+    {
+        loaderFinish();
+        load(data);
+        ready(data);
+        return;
+    }
+
+    lockEnter(&L->lock);
+    LoadJob* job = &L->jobs[L->numQueued % LOADER_MAX_JOBS];
+    job->load = load;
+    job->ready = ready;
+    job->data = data;
+    ++L->numQueued;
+    signalWake(&L->changed);
+    lockLeave(&L->lock);
+}
+
+int loaderPoll()
+{
+    Loader* L = &gLoader;
+    if (!L->running) return 0;
+
+    lockEnter(&L->lock);
+    int numLoaded = L->numLoaded;
+    lockLeave(&L->lock);
+
+    // Only the main thread touches numReady and the loaded slots, so the ready functions run without the lock.  The
+    // job is taken off the ring first in case its ready function queues another one.
+    int count = 0;
+    while (L->numReady < numLoaded)
+    {
+        LoadJob job = L->jobs[L->numReady++ % LOADER_MAX_JOBS];
+        job.ready(job.data);
+        ++count;
+    }
+    return count;
+}
+
+void loaderFinish()
+{
+    Loader* L = &gLoader;
+    if (!L->running) return;
+
+    lockEnter(&L->lock);
+    while (L->numLoaded != L->numQueued) signalWait(&L->changed, &L->lock);
+    lockLeave(&L->lock);
+
+    loaderPoll();
+}
+
+bool loaderBusy()
+{
+    // numQueued is only written by the main thread.
+    return gLoader.numReady != gLoader.numQueued;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
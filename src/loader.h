@@ -0,0 +1,41 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       loader.h
+//! @brief      Loading assets on a background thread.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <game.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// A job is split in two.  Its load function runs on a single worker thread and does the slow part: file I/O and
+// decoding.  Its ready function then runs on the main thread, from loaderPoll(), to finish up - anything that needs
+// the OpenGL context or touches state owned by the main thread.  Jobs finish in the order they were queued.
+//
+// Load functions must not call K_ALLOC and friends, which are only used from the main thread.  Anything they need
+// to allocate is freed again before their ready function returns.
+//
+// The main thread is woken from idleWait() when a job finishes, so the result is picked up on the next pass of the
+// main loop.
+//----------------------------------------------------------------------------------------------------------------------
+
+typedef void(*LoadFunc)(void* data);
+
+void loaderInit();
+void loaderDone();
+
+// Queue a job.  data is owned by the caller and must live until ready has been called.
+void loaderQueue(LoadFunc load, LoadFunc ready, void* data);
+
+// Call the ready functions of all finished jobs.  Returns the number of jobs finished.
+int loaderPoll();
+
+// Wait for all queued jobs to finish and call their ready functions.
+void loaderFinish();
+
+// YES if any jobs are queued or waiting for loaderPoll().
+bool loaderBusy();
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -10,35 +10,97 @@
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 
+#include <assets.h>
+#include <canvas.h>
+#include <cellrow.h>
+#include <fontatlas.h>
 #include <game.h>
+#include <glyphcache.h>
+#include <headless.h>
+#include <idle.h>
+#include <loader.h>
+#include <progcache.h>
+#include <raster.h>
+#include <watch.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 //----------------------------------------------------------------------------------------------------------------------
 
 #define DEBUG_GL_EXTRA_INFO     NO
 
+// YES = the damaged cells are copied into a persistently mapped pixel buffer ring and the cell texture is updated from
+// it.  NO = they are uploaded straight from client memory with glTexSubImage2D.  Either way present() writes into
+// gCells, which always holds the whole presented image; the ring is write-only, so the CPU never reads from its
+// write-combined mapping.
+#define USE_UPLOAD_RING         YES
+
+// Number of frames the upload ring can have in flight.
+#define UPLOAD_RING_SIZE        3
+
+// YES = print a line every time the upload ring has to wait for the GPU.
+#define REPORT_UPLOAD_STALLS    NO
+
 //----------------------------------------------------------------------------------------------------------------------
 
+// Available renderers for the cell grid.
+typedef enum
+{
+    RENDERER_FULLSCREEN,        // One full-screen pass that looks up the cell of every pixel (ascii.vs/ascii.fs)
+    RENDERER_INSTANCED,         // One instanced quad per cell (cells.vs/cells.fs)
+}
+Renderer;
+
 GLuint gVb;
 GLuint gProgram;
+GLuint gCellProgram;
+Renderer gRenderer = RENDERER_FULLSCREEN;
 GLuint gFontTex;
-GLuint gForeTex;
-GLuint gBackTex;
-GLuint gTextTex;
-u32* gForeImage;
-u32* gBackImage;
-u32* gTextImage;
+GLuint gCellTex;
+Cell* gCells;
+u32 gPalette[PALETTE_SIZE];
+GLuint gPaletteTex;
+Cursor gCursor;
+Viewport gView;
 bool gOpenGLReady = NO;
 int gFontWidth = 0;
 int gFontHeight = 0;
 int gImageWidth = 0;
 int gImageHeight = 0;
+int gTargetWidth = 0;           // Size in pixels that the cell grid is fitted to
+int gTargetHeight = 0;
+bool gCellsInvalid = YES;
+bool gShowStats = NO;          // YES = print timings and cache statistics (-stats, and always when headless)
+bool gRedraw = NO;              // YES = redraw the window even though no cells have changed
+CoalescePolicy gCoalesce;       // Undo coalescing policy from -coalesce
+bool gCoalesceSet = NO;         // NO = use the game's default policy
+u64 gUploadBytes = 0;
+
+STRUCT_START(UploadRing)
+{
+    GLuint      buffer;                         // Pixel unpack buffer holding UPLOAD_RING_SIZE images
+    Cell*       mapped;                         // Persistent mapping of the whole buffer
+    int         width;
+    int         height;
+    int         slot;                           // Slot being written this frame
+    GLsync      fences[UPLOAD_RING_SIZE];       // Signalled when the GPU has finished reading each slot
+    int         numStalls;
+    f64         stallTime;                      // Total seconds spent waiting on fences
+}
+STRUCT_END(UploadRing);
 
-void compileShader(GLuint shader, const char* code)
+UploadRing gRing;
+
+// Compile a shader, printing any messages.  Returns NO if it failed.
+bool compileShader(GLuint shader, const char* code, i64 size)
 {
-    GLuint result = 0;
-    GLuint infoLogLength = 0;
+    GLint result = 0;
+    GLint infoLogLength = 0;
+    GLint length = (GLint)size;
 
-    glShaderSource(shader, 1, &code, NULL);
+    glShaderSource(shader, 1, &code, &length);
     glCompileShader(shader);
     glGetShaderiv(shader, GL_COMPILE_STATUS, &result);
     glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &infoLogLength);
@@ -48,21 +110,23 @@ void compileShader(GLuint shader, const char* code)
         glGetShaderInfoLog(shader, infoLogLength, NULL, error);
         prn("%s", error);
         stringDone(&error);
-        abort();
     }
+    return result == GL_TRUE;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
+// Link a program, printing any messages.  Returns 0 if it failed.
 GLuint createProgram(GLuint vertexShader, GLuint fragmentShader)
 {
     GLuint program = glCreateProgram();
     glAttachShader(program, vertexShader);
     glAttachShader(program, fragmentShader);
+    glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
     glLinkProgram(program);
 
-    GLuint result = 0;
-    int logLength = 0;
+    GLint result = 0;
+    GLint logLength = 0;
     glGetProgramiv(program, GL_LINK_STATUS, &result);
     glGetProgramiv(program, GL_INFO_LOG_LENGTH, &logLength);
     if (logLength > 0)
@@ -71,7 +135,11 @@ GLuint createProgram(GLuint vertexShader, GLuint fragmentShader)
         glGetProgramInfoLog(program, logLength, NULL, error);
         prn("%s", error);
         stringDone(&error);
-        abort();
+    }
+    if (result != GL_TRUE)
+    {
+        glDeleteProgram(program);
+        program = 0;
     }
 
     return program;
@@ -79,42 +147,21 @@ GLuint createProgram(GLuint vertexShader, GLuint fragmentShader)
 
 //----------------------------------------------------------------------------------------------------------------------
 
-GLuint loadFontTexture(const char* fileName)
-{
-    Data file = dataLoad(fileName);
-    GLuint textureID = 0;
-
-    if (file.bytes)
-    {
-        int width, height, bpp;
-        u32* image = (u32*)stbi_load_from_memory(file.bytes, (int)file.size, &width, &height, &bpp, 4);
-        dataUnload(file);
-        gFontWidth = width / 16;
-        gFontHeight = height / 16;
+// Cells are uploaded as 2 x 32-bit unsigned integer texels.
+#define CELL_TEX_INTERNAL_FORMAT    GL_RG32UI
+#define CELL_TEX_FORMAT             GL_RG_INTEGER
+#define CELL_TEX_TYPE               GL_UNSIGNED_INT
+#define CELL_TEX_ALIGNMENT          8
 
-        glGenTextures(1, &textureID);
-        glBindTexture(GL_TEXTURE_2D, textureID);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, image);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
-        stbi_image_free(image);
-    }
-    return textureID;
-}
-
-//----------------------------------------------------------------------------------------------------------------------
-
-GLuint createDynamicTexture(int width, int height, u32** outImage)
+GLuint createDynamicTexture(int width, int height, Cell** outImage)
 {
-    u32* image = K_ALLOC_CLEAR(width * height * sizeof(u32));
-    for (int i = 0; i < width; ++i) image[i] = 0xffff00ff;
+    Cell* image = K_ALLOC_CLEAR(width * height * sizeof(Cell));
 
     GLuint texId;
     glGenTextures(1, &texId);
     glBindTexture(GL_TEXTURE_2D, texId);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, image);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, CELL_TEX_ALIGNMENT);
+    glTexImage2D(GL_TEXTURE_2D, 0, CELL_TEX_INTERNAL_FORMAT, width, height, 0, CELL_TEX_FORMAT, CELL_TEX_TYPE, image);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
@@ -126,27 +173,53 @@ GLuint createDynamicTexture(int width, int height, u32** outImage)
 
 //----------------------------------------------------------------------------------------------------------------------
 
-void resizeDynamicTexture(GLuint id, int oldWidth, int oldHeight, int newWidth, int newHeight, u32** outImage)
+void resizeDynamicTexture(GLuint id, int oldWidth, int oldHeight, int newWidth, int newHeight, Cell** outImage)
 {
-    *outImage = K_REALLOC(*outImage, oldWidth * oldHeight * sizeof(u32), newWidth * newHeight * sizeof(u32));
+    // The old size is only used by allocators that track memory.
+    (void)oldWidth;
+    (void)oldHeight;
+    *outImage = K_REALLOC(*outImage, oldWidth * oldHeight * sizeof(Cell), newWidth * newHeight * sizeof(Cell));
     glBindTexture(GL_TEXTURE_2D, id);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, newWidth, newHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, *outImage);
+    glTexImage2D(GL_TEXTURE_2D, 0, CELL_TEX_INTERNAL_FORMAT, newWidth, newHeight, 0, CELL_TEX_FORMAT, CELL_TEX_TYPE,
+        *outImage);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
-void updateDynamicTexture(GLuint texId, u32* image, int width, int height)
+void updateDynamicTexture(GLuint texId, Cell* image, int width, int height)
 {
     glBindTexture(GL_TEXTURE_2D, texId);
-    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, image);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, CELL_TEX_FORMAT, CELL_TEX_TYPE, image);
+    gUploadBytes += (u64)width * height * sizeof(Cell);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
-void destroyDynamicTexture(u32* image, int width, int height, GLuint id)
+// Upload only the damaged rectangles of an image with the given width.
+void updateDynamicTextureRects(GLuint texId, Cell* image, int width, const Damage* damage)
 {
+    if (!damage->count) return;
+
+    glBindTexture(GL_TEXTURE_2D, texId);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, width);
+    for (int i = 0; i < damage->count; ++i)
+    {
+        const DamageRect* r = &damage->rects[i];
+        glTexSubImage2D(GL_TEXTURE_2D, 0, r->x, r->y, r->w, r->h, CELL_TEX_FORMAT, CELL_TEX_TYPE,
+            &image[r->y * width + r->x]);
+        gUploadBytes += (u64)r->w * r->h * sizeof(Cell);
+    }
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void destroyDynamicTexture(Cell* image, int width, int height, GLuint id)
+{
+    (void)width;
+    (void)height;
     glDeleteTextures(1, &id);
-    K_FREE(image, width * height * sizeof(u32));
+    K_FREE(image, width * height * sizeof(Cell));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -155,8 +228,14 @@ void destroyDynamicTexture(u32* image, int width, int height, GLuint id)
 
 void glMessage(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message, const void* userParam)
 {
+    (void)id;
+    (void)length;
+    (void)userParam;
     bool showMessage = NO;
 
+    // Shader errors are printed from the info log by compileShader() and may be recoverable (see hot reloading).
+    if (source == GL_DEBUG_SOURCE_SHADER_COMPILER) return;
+
     switch (type)
     {
     case GL_DEBUG_TYPE_ERROR:
@@ -207,13 +286,493 @@ void glMessage(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei l
     }
 }
 
-void fillTexture(u32* image, GLuint id, u32 colour, int width, int height)
+void fillTexture(Cell* image, GLuint id, Cell cell, int width, int height)
 {
-    int count = width * height;
-    for (int i = 0; i < count; ++i) image[i] = colour;
+    cellFill(image, cell, width * height);
     updateDynamicTexture(id, image, width, height);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// Upload ring
+//----------------------------------------------------------------------------------------------------------------------
+
+void createUploadRing(int width, int height)
+{
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    GLsizeiptr size = (GLsizeiptr)width * height * sizeof(Cell) * UPLOAD_RING_SIZE;
+
+    gRing.width = width;
+    gRing.height = height;
+    gRing.slot = 0;
+
+    glGenBuffers(1, &gRing.buffer);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, gRing.buffer);
+    glBufferStorage(GL_PIXEL_UNPACK_BUFFER, size, NULL, flags);
+    gRing.mapped = (Cell *)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, flags);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    for (int i = 0; i < UPLOAD_RING_SIZE; ++i) gRing.fences[i] = 0;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void destroyUploadRing()
+{
+    for (int i = 0; i < UPLOAD_RING_SIZE; ++i)
+    {
+        if (gRing.fences[i]) glDeleteSync(gRing.fences[i]);
+        gRing.fences[i] = 0;
+    }
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, gRing.buffer);
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    glDeleteBuffers(1, &gRing.buffer);
+    gRing.buffer = 0;
+    gRing.mapped = 0;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// Wait until the GPU has finished with the current slot and return its cells.
+internal Cell* waitForSlot()
+{
+    GLsync fence = gRing.fences[gRing.slot];
+    if (fence)
+    {
+        if (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0) == GL_TIMEOUT_EXPIRED)
+        {
+            TimePoint t0 = timeNow();
+            while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000) == GL_TIMEOUT_EXPIRED) {}
+            f64 stall = timeToSecs(timePeriod(t0, timeNow()));
+
+            ++gRing.numStalls;
+            gRing.stallTime += stall;
+#if REPORT_UPLOAD_STALLS
+            prn("Upload ring: waited %.3fms for slot %d", stall * 1000.0, gRing.slot);
+#endif
+        }
+        glDeleteSync(fence);
+        gRing.fences[gRing.slot] = 0;
+    }
+
+    return gRing.mapped + (i64)gRing.slot * gRing.width * gRing.height;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// Copy the damaged parts of image into the current slot, update the texture from them, fence the slot and move on to
+// the next one.  Only the damaged rectangles of a slot are ever uploaded, so the rest of it needn't be kept up to date.
+void uploadThroughRing(GLuint texId, const Cell* image, const Damage* damage)
+{
+    if (!damage->count) return;
+
+    cellCopyRects(waitForSlot(), image, gRing.width, damage);
+
+    i64 slotOffset = (i64)gRing.slot * gRing.width * gRing.height;
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, gRing.buffer);
+    updateDynamicTextureRects(texId, (Cell *)GL_BUFFER_OFFSET(slotOffset * sizeof(Cell)), gRing.width, damage);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    gRing.fences[gRing.slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    gRing.slot = (gRing.slot + 1) % UPLOAD_RING_SIZE;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// Build a program from a pair of shader assets, through the program cache.  Returns 0 if a shader is missing or
+// doesn't compile.
+GLuint loadProgram(const char* vertexFileName, const char* pixelFileName)
+{
+    TimePoint startTime = timeNow();
+
+    Asset vertexCode, pixelCode;
+    bool found = assetLoad(&vertexCode, vertexFileName);
+    found = assetLoad(&pixelCode, pixelFileName) && found;
+    if (!found)
+    {
+        prn("Missing shader: %s or %s", vertexFileName, pixelFileName);
+        assetUnload(&vertexCode);
+        assetUnload(&pixelCode);
+        return 0;
+    }
+
+    // The sources are still read on a cache hit; they are part of the key, so editing a shader invalidates its binary.
+    u64 key = progCacheKey((const char*)vertexCode.bytes, vertexCode.size, (const char*)pixelCode.bytes,
+        pixelCode.size);
+    GLuint program = progCacheLoad(key);
+    bool cached = program != 0;
+
+    if (!cached)
+    {
+        GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
+        GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+
+        if (compileShader(vertexShader, (const char*)vertexCode.bytes, vertexCode.size) &&
+            compileShader(fragmentShader, (const char*)pixelCode.bytes, pixelCode.size))
+        {
+            program = createProgram(vertexShader, fragmentShader);
+        }
+        if (program)
+        {
+            glDetachShader(program, vertexShader);
+            glDetachShader(program, fragmentShader);
+            progCacheSave(program, key);
+        }
+        glDeleteShader(vertexShader);
+        glDeleteShader(fragmentShader);
+    }
+
+    if (program)
+    {
+        prn("Program: %s + %s %s %s in %.3fms", vertexFileName, pixelFileName,
+            (vertexCode.onDisk || pixelCode.onDisk) ? "from disk" : "embedded",
+            cached ? "loaded from cache" : "compiled", timeToSecs(timePeriod(startTime, timeNow())) * 1000.0);
+    }
+    else
+    {
+        prn("Program: %s + %s failed to build", vertexFileName, pixelFileName);
+    }
+
+    assetUnload(&vertexCode);
+    assetUnload(&pixelCode);
+
+    return program;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// Point a program's samplers at the texture units: fonts on unit 0, cells on unit 1, the glyph map on unit 2, the
+// palette on unit 3 and the glyph cache on unit 4.
+void bindProgramTextures(GLuint program)
+{
+    glProgramUniform1i(program, glGetUniformLocation(program, "fontTex"), 0);
+    glProgramUniform1i(program, glGetUniformLocation(program, "cellTex"), 1);
+    glProgramUniform1i(program, glGetUniformLocation(program, "glyphMap"), 2);
+    glProgramUniform1i(program, glGetUniformLocation(program, "paletteTex"), 3);
+    glProgramUniform1i(program, glGetUniformLocation(program, "glyphTex"), 4);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// Fit the cell grid to a target of the given size in pixels with the current font.
+void resizeCells(int width, int height)
+{
+    int cw = width / gFontWidth;
+    int ch = height / gFontHeight;
+
+    resizeDynamicTexture(gCellTex, gImageWidth, gImageHeight, cw, ch, &gCells);
+#if USE_UPLOAD_RING
+    destroyUploadRing();
+    createUploadRing(cw, ch);
+#endif
+    gCellsInvalid = YES;
+
+    gImageWidth = cw;
+    gImageHeight = ch;
+    gTargetWidth = width;
+    gTargetHeight = height;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Palette
+// Cells hold 8-bit palette indices, and the colours live in a 1D RGBA8 texture of PALETTE_SIZE texels shared by both
+// renderers.  A palette change, however much of the screen it recolours, costs one 1KB upload.
+//----------------------------------------------------------------------------------------------------------------------
+
+void createPaletteTexture()
+{
+    glGenTextures(1, &gPaletteTex);
+    glActiveTexture(GL_TEXTURE3);
+    glBindTexture(GL_TEXTURE_1D, gPaletteTex);
+    glTexImage1D(GL_TEXTURE_1D, 0, GL_RGBA8, PALETTE_SIZE, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glActiveTexture(GL_TEXTURE1);
+}
+
+void destroyPaletteTexture()
+{
+    glDeleteTextures(1, &gPaletteTex);
+    gPaletteTex = 0;
+}
+
+// Send gPalette (0xAABBGGRR, which is RGBA in memory) to the palette texture.
+void uploadPalette()
+{
+    glActiveTexture(GL_TEXTURE3);
+    glTexSubImage1D(GL_TEXTURE_1D, 0, 0, PALETTE_SIZE, GL_RGBA, GL_UNSIGNED_BYTE, gPalette);
+    glActiveTexture(GL_TEXTURE1);
+    gUploadBytes += sizeof(gPalette);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Fonts
+//
+// All the fonts in kFontNames are loaded at startup and kept together on the GPU in one texture array, one layer per
+// font.  A layer is GL_R32UI with one texel per glyph row (bit x set if pixel x is lit), one row of texels per glyph,
+// so a glyph pixel costs one 4-byte fetch that the rest of its row shares.  The same row masks are kept on the CPU as
+// raster fonts.  Switching fonts with selectFont() only changes the uFont uniform and refits the cell grid to the new
+// glyph size; the fonts are never re-uploaded.  Glyphs are clipped to 32 pixels wide.  Codepoints are mapped onto the
+// fonts' code page 437 glyphs, and the few glyphs beyond them that are drawn to fit each font come from the glyph
+// cache (see glyphcache.h).
+//
+// A cell can also name a font of its own (Cell.font is 1 + its index in kFontNames), which the shaders look up in the
+// same array, so a grid of mixed fonts is still drawn in one pass.
+//
+// The fonts are read and decoded on the loader thread while the window comes up with FALLBACK_FONT, which is always
+// taken from the executable and so is ready at once.  The font that was asked for is switched to when it arrives.
+// Only their headers are read before that, to size the font array for the tallest one up front.  A font that is
+// reloaded taller than that is refused rather than reallocating the array.
+//----------------------------------------------------------------------------------------------------------------------
+
+internal const char* kFontNames[] = { "font1", "font2", "font3", "font4", "font5" };
+
+#define NUM_FONTS       ((int)(sizeof(kFontNames) / sizeof(kFontNames[0])))
+#define FALLBACK_FONT   4       // font5
+
+RasterFont gFonts[NUM_FONTS];   // Glyph row masks, also uploaded to the font's layer.  Cleared until loaded.
+int gFont = FALLBACK_FONT;      // Font in use
+int gWantedFont = 0;            // Font to switch to as soon as it has loaded
+int gFontRows = 0;              // Glyph rows in each layer of the font texture, for the tallest font found at startup
+int gGlyphCacheGlyphs = GLYPH_CACHE_GLYPHS;
+
+int findFont(const char* name)
+{
+    for (int i = 0; i < NUM_FONTS; ++i)
+    {
+        if (strcmp(kFontNames[i], name) == 0) return i;
+    }
+    return -1;
+}
+
+// Look up the glyph of every cell on screen again, after the grid's font has changed or the glyph cache has been
+// flushed.  The cells themselves haven't changed, so nothing but the missing glyphs is uploaded.
+internal void refreshGlyphs()
+{
+    if (!gCellTex || gCellsInvalid) return;
+
+    Damage all;
+    damageClear(&all);
+    damageAdd(&all, 0, 0, gImageWidth, gImageHeight);
+    glyphCacheUpdate(gCells, gImageWidth, gImageHeight, &all, gFont);
+    gRedraw = YES;
+}
+
+// Find the height of the tallest font from the headers of the files that fontLoadJob() and setFallbackFont() will
+// read.  A .fnt is mapped or embedded, so this costs no decoding, and stb_image reads a PNG's size from its header.
+internal int tallestFont()
+{
+    int rows = 1;
+    char fileName[80];
+    Asset asset;
+    FontAtlas atlas;
+
+    for (int i = 0; i <= NUM_FONTS; ++i)
+    {
+        // The last pass is the fallback font, which always comes from the executable.
+        const char* name = kFontNames[i < NUM_FONTS ? i : FALLBACK_FONT];
+        snprintf(fileName, sizeof(fileName), "%s.fnt", name);
+        bool found = i < NUM_FONTS ? assetLoad(&asset, fileName) : assetLoadEmbedded(&asset, fileName);
+        if (found && fontAtlasLoad(&atlas, asset.bytes, asset.size))
+        {
+            rows = K_MAX(rows, atlas.glyphHeight);
+            fontAtlasDone(&atlas);
+        }
+        else if (i < NUM_FONTS)
+        {
+            assetUnload(&asset);
+            snprintf(fileName, sizeof(fileName), "%s.png", name);
+            int width, height, bpp;
+            if (assetLoad(&asset, fileName) && stbi_info_from_memory(asset.bytes, (int)asset.size, &width, &height,
+                &bpp))
+            {
+                rows = K_MAX(rows, height / 16);
+            }
+        }
+        assetUnload(&asset);
+    }
+
+    return rows;
+}
+
+// Allocate the font texture, once, with a layer per font that holds the tallest of them.  Every layer starts blank,
+// so a cell using a font that hasn't loaded yet is drawn blank.
+internal void createFontTexture()
+{
+    u32* texels = K_ALLOC_CLEAR(gFontRows * GLYPH_MAP_FONT_GLYPHS * NUM_FONTS * sizeof(u32));
+    glGenTextures(1, &gFontTex);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, gFontTex);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_R32UI, gFontRows, GLYPH_MAP_FONT_GLYPHS, NUM_FONTS, 0, GL_RED_INTEGER,
+        GL_UNSIGNED_INT, texels);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glActiveTexture(GL_TEXTURE1);
+    K_FREE(texels, gFontRows * GLYPH_MAP_FONT_GLYPHS * NUM_FONTS * sizeof(u32));
+}
+
+// Copy a font's masks into its layer, padding with blank rows and glyphs.  The font texture lives on texture unit 0;
+// unit 1 (the cell texture) is left active for the cell texture functions.
+internal void uploadFontLayer(int index)
+{
+    const RasterFont* font = &gFonts[index];
+    int size = gFontRows * GLYPH_MAP_FONT_GLYPHS;
+    u32* texels = K_ALLOC_CLEAR(size * sizeof(u32));
+    for (int g = 0; g < K_MIN(font->numGlyphs, GLYPH_MAP_FONT_GLYPHS); ++g)
+    {
+        memcpy(texels + g * gFontRows, font->masks + g * font->height, font->height * sizeof(u32));
+    }
+    glActiveTexture(GL_TEXTURE0);
+    glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, index, gFontRows, GLYPH_MAP_FONT_GLYPHS, 1, GL_RED_INTEGER,
+        GL_UNSIGNED_INT, texels);
+    glActiveTexture(GL_TEXTURE1);
+    K_FREE(texels, size * sizeof(u32));
+}
+
+// Keep a newly loaded font and put it in its layer of the font texture.  Glyphs synthesized for its old size are
+// dropped from the glyph cache.
+internal void storeFont(int index, const FontAtlas* atlas)
+{
+    RasterFont* font = &gFonts[index];
+    rasterFontDone(font);
+    rasterFontInit(font, atlas);
+    uploadFontLayer(index);
+    glyphCacheFlush(index);
+    refreshGlyphs();
+}
+
+// Draw with a loaded font from now on.
+internal void useFont(int index)
+{
+    gFont = index;
+    int oldWidth = gFontWidth;
+    int oldHeight = gFontHeight;
+    gFontWidth = gFonts[index].width;
+    gFontHeight = gFonts[index].height;
+
+    // A font of the same size only needs its glyphs; the shaders pick its map layer with uFont.
+    if (gCellTex && (gFontWidth != oldWidth || gFontHeight != oldHeight)) resizeCells(gTargetWidth, gTargetHeight);
+    else refreshGlyphs();
+}
+
+// Switch fonts.  If the font is still loading, it is switched to when it arrives.
+void selectFont(int index)
+{
+    gWantedFont = index;
+    if (gFonts[index].masks && index != gFont) useFont(index);
+}
+
+STRUCT_START(FontLoad)
+{
+    int         index;
+    char        fileName[80];
+    Asset       asset;          // Backs atlas
+    FontAtlas   atlas;          // Valid if a .fnt was found
+    u32*        image;          // Otherwise the decoded PNG (from stb_image, not K_ALLOC)
+    int         imageWidth;
+    int         imageHeight;
+    TimePoint   queueTime;
+    f64         loadTime;       // Seconds spent on the loader thread
+}
+STRUCT_END(FontLoad);
+
+// Loader thread: find the precompiled <name>.fnt, embedded or in the override directory, or decode <name>.png.
+internal void fontLoadJob(void* data)
+{
+    FontLoad* load = (FontLoad*)data;
+    const char* name = kFontNames[load->index];
+    TimePoint t0 = timeNow();
+
+    snprintf(load->fileName, sizeof(load->fileName), "%s.fnt", name);
+    if (!assetLoad(&load->asset, load->fileName) ||
+        !fontAtlasLoad(&load->atlas, load->asset.bytes, load->asset.size))
+    {
+        assetUnload(&load->asset);
+        snprintf(load->fileName, sizeof(load->fileName), "%s.png", name);
+        Asset file;
+        if (assetLoad(&file, load->fileName))
+        {
+            int bpp;
+            load->image = (u32*)stbi_load_from_memory(file.bytes, (int)file.size, &load->imageWidth,
+                &load->imageHeight, &bpp, 4);
+            assetUnload(&file);
+        }
+    }
+
+    load->loadTime = timeToSecs(timePeriod(t0, timeNow()));
+}
+
+// Main thread: convert a PNG to 1 bit per pixel if necessary, and store the font.
+internal void fontReady(void* data)
+{
+    FontLoad* load = (FontLoad*)data;
+    const char* how = load->asset.onDisk ? "mapped" : "embedded";
+
+    if (load->image)
+    {
+        fontAtlasFromImage(&load->atlas, load->image, load->imageWidth, load->imageHeight);
+        stbi_image_free(load->image);
+        how = "decoded";
+    }
+
+    if (load->atlas.bits && load->atlas.glyphHeight > gFontRows)
+    {
+        prn("Font: %s is %d pixels tall, but there is only room for %d; restart to use it", load->fileName,
+            load->atlas.glyphHeight, gFontRows);
+    }
+    else if (load->atlas.bits)
+    {
+        storeFont(load->index, &load->atlas);
+
+        // A reloaded font in use may have changed size.
+        if (load->index == gWantedFont || load->index == gFont) useFont(load->index);
+
+        prn("Font: %s %s in %.3fms on the loader thread, ready %.3fms after it was queued", load->fileName, how,
+            load->loadTime * 1000.0, timeToSecs(timePeriod(load->queueTime, timeNow())) * 1000.0);
+    }
+    else
+    {
+        prn("Font: %s not found", kFontNames[load->index]);
+    }
+
+    fontAtlasDone(&load->atlas);
+    assetUnload(&load->asset);
+    K_FREE(load, sizeof(*load));
+}
+
+// Start loading a font in the background.  It is stored by the first loaderPoll() after it has loaded.
+void loadFont(int index)
+{
+    FontLoad* load = K_ALLOC_CLEAR(sizeof(FontLoad));
+    load->index = index;
+    load->queueTime = timeNow();
+    loaderQueue(&fontLoadJob, &fontReady, load);
+}
+
+// Use the fallback font straight from the executable.
+void setFallbackFont()
+{
+    char fileName[80];
+    Asset asset;
+    FontAtlas atlas;
+    snprintf(fileName, sizeof(fileName), "%s.fnt", kFontNames[FALLBACK_FONT]);
+    if (!assetLoadEmbedded(&asset, fileName) || !fontAtlasLoad(&atlas, asset.bytes, asset.size))
+    {
+        prn("Font: the fallback font is missing from the executable");
+        abort();
+    }
+    storeFont(FALLBACK_FONT, &atlas);
+    useFont(FALLBACK_FONT);
+    fontAtlasDone(&atlas);
+    assetUnload(&asset);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 void initOpenGL(int width, int height)
 {
     static const GLfloat buffer[] = {
@@ -229,6 +788,8 @@ void initOpenGL(int width, int height)
             1.0f,   1.0f,   1.0f,   1.0f,
     };
 
+    loaderInit();
+
     glEnable(GL_DEBUG_OUTPUT);
     glDebugMessageCallback(glMessage, 0);
 
@@ -241,61 +802,43 @@ void initOpenGL(int width, int height)
     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), GL_BUFFER_OFFSET(0));
     glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), GL_BUFFER_OFFSET(2 * sizeof(float)));
 
-    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-
-    Data vertexCode = dataLoad("ascii.vs");
-    Data pixelCode = dataLoad("ascii.fs");
-
-    compileShader(vertexShader, vertexCode.bytes);
-    compileShader(fragmentShader, pixelCode.bytes);
-    gProgram = createProgram(vertexShader, fragmentShader);
-
-    glDetachShader(gProgram, vertexShader);
-    glDetachShader(gProgram, fragmentShader);
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
-
-    dataUnload(vertexCode);
-    dataUnload(pixelCode);
+    // Set up textures.  The fonts are on unit 0, the glyph cache binds its textures to units 2 and 4, and the palette
+    // is on unit 3.  The fallback font goes in before any loads are queued: without a worker thread they finish inside
+    // loadFont(), and the wanted font must not then be replaced by the fallback.
+    gFontRows = tallestFont();
+    createFontTexture();
+    glyphCacheInit(gFonts, NUM_FONTS, gFontRows, gGlyphCacheGlyphs);
+    createPaletteTexture();
+    setFallbackFont();
+
+    // Reading and decoding the fonts overlaps compiling the shaders.  The wanted font goes first.
+    loadFont(gWantedFont);
+    for (int i = 0; i < NUM_FONTS; ++i)
+    {
+        if (i != gWantedFont) loadFont(i);
+    }
 
-    glUseProgram(gProgram);
+    gProgram = loadProgram("ascii.vs", "ascii.fs");
+    gCellProgram = loadProgram("cells.vs", "cells.fs");
+    if (!gProgram || !gCellProgram) abort();
 
-    // Set up textures
-    gFontTex = loadFontTexture("font1.png");
     int cw = width / gFontWidth;
     int ch = height / gFontHeight;
-    gForeTex = createDynamicTexture(cw, ch, &gForeImage);
-    gBackTex = createDynamicTexture(cw, ch, &gBackImage);
-    gTextTex = createDynamicTexture(cw, ch, &gTextImage);
-    gImageWidth = cw;
-    gImageHeight = ch;
-
-    GLuint loc;
-
-    // Bind shader variable "fontTex" to texture unit 0, then bind our texture to texture unit 0.
-    loc = glGetUniformLocation(gProgram, "fontTex");
-    glUniform1i(loc, 0);
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, gFontTex);
 
-    // Bind shader variable "foreTex" to texture unit 1, then bind our texture to texture unit 1.
-    loc = glGetUniformLocation(gProgram, "foreTex");
-    glUniform1i(loc, 1);
+    // Bind shader variable "cellTex" to texture unit 1, then bind our texture to texture unit 1.
     glActiveTexture(GL_TEXTURE1);
-    glBindTexture(GL_TEXTURE_2D, gForeTex);
-
-    // Bind shader variable "fontTex" to texture unit 2, then bind our texture to texture unit 2.
-    loc = glGetUniformLocation(gProgram, "backTex");
-    glUniform1i(loc, 2);
-    glActiveTexture(GL_TEXTURE2);
-    glBindTexture(GL_TEXTURE_2D, gBackTex);
+    gCellTex = createDynamicTexture(cw, ch, &gCells);
+    glBindTexture(GL_TEXTURE_2D, gCellTex);
+    gImageWidth = cw;
+    gImageHeight = ch;
+    gTargetWidth = width;
+    gTargetHeight = height;
+#if USE_UPLOAD_RING
+    createUploadRing(cw, ch);
+#endif
 
-    // Bind shader variable "fontTex" to texture unit 3, then bind our texture to texture unit 3.
-    loc = glGetUniformLocation(gProgram, "asciiTex");
-    glUniform1i(loc, 3);
-    glActiveTexture(GL_TEXTURE3);
-    glBindTexture(GL_TEXTURE_2D, gTextTex);
+    bindProgramTextures(gProgram);
+    bindProgramTextures(gCellProgram);
 
     gOpenGLReady = YES;
 }
@@ -304,35 +847,78 @@ void initOpenGL(int width, int height)
 
 void doneOpenGL()
 {
+    loaderDone();
+
     glDisableVertexAttribArray(0);
     glDisableVertexAttribArray(1);
     glDeleteBuffers(1, &gVb);
     glDeleteProgram(gProgram);
+    glDeleteProgram(gCellProgram);
+    if (gShowStats) glyphCacheReport();
+    glyphCacheDone();
     glDeleteTextures(1, &gFontTex);
-
-    destroyDynamicTexture(gForeImage, gImageWidth, gImageHeight, gForeTex);
-    destroyDynamicTexture(gBackImage, gImageWidth, gImageHeight, gBackTex);
-    destroyDynamicTexture(gTextImage, gImageWidth, gImageHeight, gTextTex);
+    gFontTex = 0;
+    destroyPaletteTexture();
+    for (int i = 0; i < NUM_FONTS; ++i) rasterFontDone(&gFonts[i]);
+
+    destroyDynamicTexture(gCells, gImageWidth, gImageHeight, gCellTex);
+#if USE_UPLOAD_RING
+    destroyUploadRing();
+    if (gShowStats) prn("Upload ring: %d stalls, %.3fms total", gRing.numStalls, gRing.stallTime * 1000.0);
+#endif
 
     gOpenGLReady = NO;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
-void runPresentation(const Window* wnd)
+void setViewUniforms(GLuint program, const Viewport* view, const Cursor* cursor)
 {
+    glProgramUniform2i(program, glGetUniformLocation(program, "uViewOrigin"), view->x, view->y);
+    glProgramUniform2i(program, glGetUniformLocation(program, "uCursorPos"), cursor->x, cursor->y);
+    glProgramUniform1i(program, glGetUniformLocation(program, "uCursorStyle"), cursor->style);
+    glProgramUniform2ui(program, glGetUniformLocation(program, "uCursorColours"), cursor->colour, cursor->textColour);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// Bring the cell texture up to date with the game.  Returns the number of bytes uploaded.
+u64 updatePresentation()
+{
+    u64 uploadStart = gUploadBytes;
+    Damage damage;
     PresentIn pin;
     pin.width = gImageWidth;
     pin.height = gImageHeight;
-    pin.foreImage = gForeImage;
-    pin.backImage = gBackImage;
-    pin.textImage = gTextImage;
+    pin.palette = gPalette;
+    pin.full = gCellsInvalid;
+    pin.damage = &damage;
+    pin.cursor = &gCursor;
+    pin.view = &gView;
+    pin.cells = gCells;
     present(&pin);
+    glyphCacheUpdate(gCells, gImageWidth, gImageHeight, &damage, gFont);
+#if USE_UPLOAD_RING
+    uploadThroughRing(gCellTex, gCells, &damage);
+#else
+    updateDynamicTextureRects(gCellTex, gCells, gImageWidth, &damage);
+#endif
+    gCellsInvalid = NO;
+
+    if (damage.palette) uploadPalette();
+
+    // Scrolling and the cursor are handled by the shaders, so they never cost an upload.
+    setViewUniforms(gProgram, &gView, &gCursor);
+    setViewUniforms(gCellProgram, &gView, &gCursor);
+
+    return gUploadBytes - uploadStart;
+}
 
-    updateDynamicTexture(gForeTex, gForeImage, gImageWidth, gImageHeight);
-    updateDynamicTexture(gBackTex, gBackImage, gImageWidth, gImageHeight);
-    updateDynamicTexture(gTextTex, gTextImage, gImageWidth, gImageHeight);
+//----------------------------------------------------------------------------------------------------------------------
 
+void runPresentation(const Window* wnd)
+{
+    updatePresentation();
     windowRedraw(wnd);
 }
 
@@ -342,17 +928,37 @@ void onSize(const Window* wnd, int width, int height)
 {
     if (gOpenGLReady)
     {
-        int cw = width / gFontWidth;
-        int ch = height / gFontHeight;
+        resizeCells(width, height);
+        runPresentation(wnd);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// Draw a grid of cells covering a target of the given size with one of the renderers.
+void drawCells(Renderer renderer, int columns, int rows, int width, int height)
+{
+    GLuint program = (renderer == RENDERER_INSTANCED) ? gCellProgram : gProgram;
 
-        resizeDynamicTexture(gForeTex, gImageWidth, gImageHeight, cw, ch, &gForeImage);
-        resizeDynamicTexture(gBackTex, gImageWidth, gImageHeight, cw, ch, &gBackImage);
-        resizeDynamicTexture(gTextTex, gImageWidth, gImageHeight, cw, ch, &gTextImage);
+    // Set uniforms
+    GLint uFontRes = glGetUniformLocation(program, "uFontRes");
+    glProgramUniform2f(program, uFontRes, (float)gFontWidth, (float)gFontHeight);
+    GLint uFont = glGetUniformLocation(program, "uFont");
+    glProgramUniform1i(program, uFont, gFont);
+    GLint uResolution = glGetUniformLocation(program, "uResolution");
+    glProgramUniform2f(program, uResolution, (float)width, (float)height);
 
-        gImageWidth = cw;
-        gImageHeight = ch;
+    glUseProgram(program);
 
-        runPresentation(wnd);
+    if (renderer == RENDERER_INSTANCED)
+    {
+        GLint uColumns = glGetUniformLocation(program, "uColumns");
+        glProgramUniform1i(program, uColumns, columns);
+        glDrawArraysInstanced(GL_TRIANGLES, 0, 6, columns * rows);
+    }
+    else
+    {
+        glDrawArrays(GL_TRIANGLES, 0, 6);
     }
 }
 
@@ -366,27 +972,618 @@ void onPaint(const Window* wnd)
         glClearColor(0, 0, 0, 1);
         glClear(GL_COLOR_BUFFER_BIT);
 
-        // Set uniforms
-        GLint uFontRes = glGetUniformLocation(gProgram, "uFontRes");
-        glProgramUniform2f(gProgram, uFontRes, (float)gFontWidth, (float)gFontHeight);
-        GLint uResolution = glGetUniformLocation(gProgram, "uResolution");
-        glProgramUniform2f(gProgram, uResolution, (float)wnd->bounds.w, (float)wnd->bounds.h);
+        drawCells(gRenderer, gImageWidth, gImageHeight, wnd->bounds.w, wnd->bounds.h);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Hot reloading
+//
+// With an override directory (-data), the directory is watched while the window is open.  When a shader or one of
+// the fonts' .fnt or .png is written, it is reloaded once the directory has been quiet for RELOAD_SETTLE_TIME
+// seconds, which lets an editor finish saving.  The reload happens between passes of the main loop: programs are
+// rebuilt and swapped in there and then, and the font goes through the loader like any other font load, so a frame
+// is always drawn entirely with the old resources or entirely with the new ones.  The game's state is untouched.
+//
+// A shader that doesn't compile leaves the old program in place.
+//----------------------------------------------------------------------------------------------------------------------
 
-        glUseProgram(gProgram);
+#define RELOAD_SETTLE_TIME  0.1
 
-        glDrawArrays(GL_TRIANGLES, 0, 6);
+// The watcher is polled at least this often (in seconds) while idle.  On Windows idleWait() doesn't wake for it.
+#define RELOAD_POLL_PERIOD  0.1
+
+STRUCT_START(Reload)
+{
+    bool        program;
+    bool        cellProgram;
+    u32         fonts;          // Bit per font in kFontNames
+    TimePoint   lastChange;
+}
+STRUCT_END(Reload);
+
+Reload gReload;
+
+internal bool reloadPending()
+{
+    return gReload.program || gReload.cellProgram || gReload.fonts;
+}
+
+internal void reloadProgram(GLuint* program, const char* vertexFileName, const char* pixelFileName)
+{
+    GLuint newProgram = loadProgram(vertexFileName, pixelFileName);
+    if (!newProgram)
+    {
+        prn("Reload: keeping the old %s + %s", vertexFileName, pixelFileName);
+        return;
+    }
+
+    bindProgramTextures(newProgram);
+    glDeleteProgram(*program);
+    *program = newProgram;
+
+    // The other uniforms are set every time the cells are presented or drawn.
+    gCellsInvalid = YES;
+}
+
+// Collect changes from the watcher, and reload what they affect once they have settled.
+void checkReload()
+{
+    char name[WATCH_NAME_SIZE];
+
+    while (watchPoll(name))
+    {
+        bool used = YES;
+        if (strcmp(name, "ascii.vs") == 0 || strcmp(name, "ascii.fs") == 0) gReload.program = YES;
+        else if (strcmp(name, "cells.vs") == 0 || strcmp(name, "cells.fs") == 0) gReload.cellProgram = YES;
+        else
+        {
+            // Fonts: <name>.fnt or <name>.png
+            used = NO;
+            char* ext = strrchr(name, '.');
+            if (ext && (strcmp(ext, ".fnt") == 0 || strcmp(ext, ".png") == 0))
+            {
+                *ext = 0;
+                int font = findFont(name);
+                if (font >= 0)
+                {
+                    gReload.fonts |= 1u << font;
+                    used = YES;
+                }
+            }
+        }
+
+        if (used) gReload.lastChange = timeNow();
+    }
+
+    if (!reloadPending() || timeToSecs(timePeriod(gReload.lastChange, timeNow())) < RELOAD_SETTLE_TIME) return;
+
+    if (gReload.program) reloadProgram(&gProgram, "ascii.vs", "ascii.fs");
+    if (gReload.cellProgram) reloadProgram(&gCellProgram, "cells.vs", "cells.fs");
+    for (int i = 0; i < NUM_FONTS; ++i)
+    {
+        if (gReload.fonts & (1u << i)) loadFont(i);
+    }
+    memoryClear(&gReload, sizeof(gReload));
+}
+
+// Seconds until checkReload() next needs to run, or -1 if it only needs to run when woken.
+f64 timeUntilReload()
+{
+    if (reloadPending())
+    {
+        return K_MAX(0.0, RELOAD_SETTLE_TIME - timeToSecs(timePeriod(gReload.lastChange, timeNow())));
+    }
+    return watchActive() ? RELOAD_POLL_PERIOD : -1.0;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Offscreen rendering
+//----------------------------------------------------------------------------------------------------------------------
+
+STRUCT_START(RenderTarget)
+{
+    GLuint  fbo;
+    GLuint  colour;
+    int     width;
+    int     height;
+}
+STRUCT_END(RenderTarget);
+
+// Create an RGBA8 framebuffer, bind it and set the viewport to cover it.
+void createRenderTarget(RenderTarget* target, int width, int height)
+{
+    target->width = width;
+    target->height = height;
+    glGenFramebuffers(1, &target->fbo);
+    glGenRenderbuffers(1, &target->colour);
+    glBindRenderbuffer(GL_RENDERBUFFER, target->colour);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    glBindFramebuffer(GL_FRAMEBUFFER, target->fbo);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, target->colour);
+    glViewport(0, 0, width, height);
+}
+
+void destroyRenderTarget(RenderTarget* target)
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glDeleteFramebuffers(1, &target->fbo);
+    glDeleteRenderbuffers(1, &target->colour);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// CPU rendering
+//----------------------------------------------------------------------------------------------------------------------
+
+// Count the pixels of a CPU rendered image that differ in colour from the top-left of the bound framebuffer.
+int compareWithFramebuffer(const u32* pixels, int width, int height, int targetHeight)
+{
+    u32* gpu = K_ALLOC(sizeof(u32) * width * height);
+    int numDiffs = 0;
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glReadPixels(0, targetHeight - height, width, height, GL_RGBA, GL_UNSIGNED_BYTE, gpu);
+
+    // OpenGL rows run bottom to top.
+    for (int y = 0; y < height; ++y)
+    {
+        const u32* gpuRow = gpu + (height - 1 - y) * width;
+        const u32* cpuRow = pixels + y * width;
+        for (int x = 0; x < width; ++x)
+        {
+            if ((gpuRow[x] ^ cpuRow[x]) & 0x00ffffff) ++numDiffs;
+        }
     }
+
+    K_FREE(gpu, sizeof(u32) * width * height);
+    return numDiffs;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// Save an image as a binary PPM.
+bool writePpm(const char* fileName, const u32* pixels, int width, int height)
+{
+    FILE* f = fopen(fileName, "wb");
+    if (!f) return NO;
+
+    u8* line = K_ALLOC(width * 3);
+    fprintf(f, "P6\n%d %d\n255\n", width, height);
+    for (int y = 0; y < height; ++y)
+    {
+        const u32* row = pixels + y * width;
+        for (int x = 0; x < width; ++x)
+        {
+            line[x * 3 + 0] = (u8)(row[x]);
+            line[x * 3 + 1] = (u8)(row[x] >> 8);
+            line[x * 3 + 2] = (u8)(row[x] >> 16);
+        }
+        fwrite(line, 3, width, f);
+    }
+    K_FREE(line, width * 3);
+
+    return fclose(f) == 0;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Benchmark
+//----------------------------------------------------------------------------------------------------------------------
+
+// Time the cell copy and fill kernels on a 4K grid's worth of cells, in whole-grid and tile-sized runs.
+void runKernelBenchmark()
+{
+    const int numCells = 384 * 135;
+    const int numPasses = 200;
+    static const int kRuns[] = { 384 * 135, TILE_SIZE };
+    Cell* src = K_ALLOC(numCells * sizeof(Cell));
+    Cell* dst = K_ALLOC(numCells * sizeof(Cell));
+    Cell value = cellMake('x', COLOUR_WHITE, COLOUR_BLACK, 0);
+
+    for (int i = 0; i < numCells; ++i) src[i] = cellMake((u32)i, (u8)i, (u8)(i >> 8), 0);
+
+    prn("Cell kernels (%d cells):", numCells);
+    for (int r = 0; r < (int)(sizeof(kRuns) / sizeof(kRuns[0])); ++r)
+    {
+        int run = kRuns[r];
+        f64 fillUs[SIMD_COUNT], copyUs[SIMD_COUNT];
+        SimdPath best = cpuBestPath();
+
+        for (int p = 0; p <= (int)best; ++p)
+        {
+            CellFillFunc fill = cellFillFunc((SimdPath)p);
+            CellCopyFunc copy = cellCopyFunc((SimdPath)p);
+
+            TimePoint t0 = timeNow();
+            for (int pass = 0; pass < numPasses; ++pass)
+            {
+                for (int i = 0; i + run <= numCells; i += run) fill(dst + i, value, run);
+            }
+            TimePoint t1 = timeNow();
+            for (int pass = 0; pass < numPasses; ++pass)
+            {
+                for (int i = 0; i + run <= numCells; i += run) copy(dst + i, src + i, run);
+            }
+            TimePoint t2 = timeNow();
+
+            fillUs[p] = timeToSecs(timePeriod(t0, t1)) * 1000000.0 / numPasses;
+            copyUs[p] = timeToSecs(timePeriod(t1, t2)) * 1000000.0 / numPasses;
+        }
+
+        for (int k = 0; k < 2; ++k)
+        {
+            f64* us = k == 0 ? fillUs : copyUs;
+            pr("  %s runs of %5d:", k == 0 ? "fill" : "copy", run);
+            for (int p = 0; p <= (int)best; ++p)
+            {
+                pr(" %s %.1fus (%.1fx)", cpuPathName((SimdPath)p), us[p], us[SIMD_SCALAR] / us[p]);
+            }
+            prn("");
+        }
+    }
+
+    K_FREE(src, numCells * sizeof(Cell));
+    K_FREE(dst, numCells * sizeof(Cell));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// Compare the renderers' GPU frame times on grids from 80x25 up to 4K using the current font, along with the CPU
+// rasterizer's time and how many of its pixels differ from the GPU's.
+void runBenchmark()
+{
+    static const int kResolutions[][2] = {
+        { 0, 0 },               // 80x25 cells
+        { 1280, 720 },
+        { 1920, 1080 },
+        { 2560, 1440 },
+        { 3840, 2160 },
+    };
+    static const char* kNames[] = { "fullscreen", "instanced" };
+    const int numFrames = 100;
+    SimdPath bestPath = cpuBestPath();
+
+    GLuint query;
+    glGenQueries(1, &query);
+
+    // The game isn't running, so use a random palette so colour mistakes show up in the comparison.
+    u32 seed = 54321;
+    for (int c = 0; c < PALETTE_SIZE; ++c)
+    {
+        seed = seed * 1664525 + 1013904223;
+        gPalette[c] = seed | 0xff000000;
+    }
+    uploadPalette();
+
+    prn("Font: %dx%d", gFontWidth, gFontHeight);
+    for (int i = 0; i < (int)(sizeof(kResolutions) / sizeof(kResolutions[0])); ++i)
+    {
+        int columns = i == 0 ? 80 : kResolutions[i][0] / gFontWidth;
+        int rows = i == 0 ? 25 : kResolutions[i][1] / gFontHeight;
+        int width = columns * gFontWidth;
+        int height = rows * gFontHeight;
+
+        // Fill a grid with varied cells.
+        Cell* cells;
+        GLuint cellTex = createDynamicTexture(columns, rows, &cells);
+        u32 seed = 12345;
+        for (int c = 0; c < columns * rows; ++c)
+        {
+            seed = seed * 1664525 + 1013904223;
+            cells[c] = cellMake(' ' + (seed >> 8) % 95, (u8)(seed >> 16), (u8)(seed >> 24), 0);
+        }
+        Damage all;
+        damageClear(&all);
+        damageAdd(&all, 0, 0, columns, rows);
+        glyphCacheUpdate(cells, columns, rows, &all, gFont);
+        updateDynamicTexture(cellTex, cells, columns, rows);
+        glActiveTexture(GL_TEXTURE1);
+        glBindTexture(GL_TEXTURE_2D, cellTex);
+
+        // Render into an offscreen target of the grid's size.
+        RenderTarget target;
+        createRenderTarget(&target, width, height);
+
+        f64 ms[2];
+        for (int r = 0; r < 2; ++r)
+        {
+            // Warm up, then time each frame on the GPU.
+            for (int f = 0; f < 5; ++f) drawCells((Renderer)r, columns, rows, width, height);
+            glFinish();
+
+            u64 total = 0;
+            for (int f = 0; f < numFrames; ++f)
+            {
+                GLuint64 ns = 0;
+                glBeginQuery(GL_TIME_ELAPSED, query);
+                drawCells((Renderer)r, columns, rows, width, height);
+                glEndQuery(GL_TIME_ELAPSED);
+                glGetQueryObjectui64v(query, GL_QUERY_RESULT, &ns);
+                total += ns;
+            }
+            ms[r] = (f64)total / numFrames / 1000000.0;
+        }
+
+        // Time the CPU rasterizer's scalar and best paths, then check the result against the last GPU frame.
+        u32* pixels = K_ALLOC(sizeof(u32) * width * height);
+        SimdPath paths[2] = { SIMD_SCALAR, bestPath };
+        f64 cpuMs[2];
+        RasterIn rin;
+        memoryClear(&rin, sizeof(rin));
+        rin.font = &gFonts[gFont];
+        rin.fonts = gFonts;
+        rin.numFonts = NUM_FONTS;
+        rin.cells = cells;
+        rin.columns = columns;
+        rin.rows = rows;
+        rin.palette = gPalette;
+        rin.pixels = pixels;
+        rin.pitch = width;
+        for (int p = 0; p < 2; ++p)
+        {
+            const int numCpuFrames = 10;
+            rin.path = paths[p];
+            rasterize(&rin);
+            TimePoint t0 = timeNow();
+            for (int f = 0; f < numCpuFrames; ++f) rasterize(&rin);
+            cpuMs[p] = timeToSecs(timePeriod(t0, timeNow())) * 1000.0 / numCpuFrames;
+        }
+        int numDiffs = compareWithFramebuffer(pixels, width, height, height);
+        K_FREE(pixels, sizeof(u32) * width * height);
+
+        prn("%4dx%-4d cells (%4dx%-4d pixels): %s %.3fms, %s %.3fms",
+            columns, rows, width, height, kNames[0], ms[0], kNames[1], ms[1]);
+        prn("%32s cpu %s %.3fms, cpu %s %.3fms, %d pixels differ from the GPU", "",
+            cpuPathName(SIMD_SCALAR), cpuMs[0], cpuPathName(bestPath), cpuMs[1], numDiffs);
+
+        destroyRenderTarget(&target);
+        destroyDynamicTexture(cells, columns, rows, cellTex);
+    }
+
+    glDeleteQueries(1, &query);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, gCellTex);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Headless workload
+//----------------------------------------------------------------------------------------------------------------------
+
+internal void scriptKey(Array(KeyState)* keys, int vkey, u32 ch, bool shift, bool ctrl)
+{
+    KeyState* k = arrayNew(*keys);
+    memoryClear(k, sizeof(KeyState));
+    k->down = YES;
+    k->vkey = vkey;
+    k->ch = ch;
+    k->shift = shift;
+    k->ctrl = ctrl;
+}
+
+// The scripted input for a frame: type a line of text a character per frame, with every eighth character taken from
+// kSymbols instead, start a new line every 64 characters, change the typing font every 16 characters and undo/redo the
+// last burst every 240 frames.  The colours start cycling at frame 30 and the theme changes every 100 frames.
+internal void scriptFrame(int frame, Array(KeyState)* keys)
+{
+    static const char* kText = "The quick brown fox jumps over the lazy dog. 0123456789 !\"#$%&'()*+,-./:;<=>?@[]^_{|}~";
+
+    // Box drawing, shading, Latin-1, Greek and symbols from the fonts, block elements and braille drawn to fit them,
+    // and CJK that nothing has.
+    static const u32 kSymbols[] = {
+        0x2500, 0x2502, 0x250c, 0x2510, 0x2514, 0x2518, 0x253c, 0x2550, 0x2551, 0x256c, 0x2591, 0x2592, 0x2593,
+        0x2588, 0x00e9, 0x00fc, 0x00f1, 0x00c7, 0x00a3, 0x03b1, 0x03b2, 0x03c0, 0x03a3, 0x221e, 0x2248, 0x263a,
+        0x2665, 0x266b, 0x2190, 0x2192, 0x2581, 0x2586, 0x258a, 0x258e, 0x2594, 0x2595, 0x2599, 0x259a, 0x28ff,
+        0x2847, 0x28b8, 0x2801, 0x4e2d, 0x6587,
+    };
+    int column = frame % 64;
+
+    if (frame > 0 && column == 0)
+    {
+        scriptKey(keys, VK_DOWN, 0, NO, NO);
+        for (int i = 0; i < 6; ++i) scriptKey(keys, VK_LEFT, 0, YES, NO);
+        for (int i = 0; i < 4; ++i) scriptKey(keys, VK_LEFT, 0, NO, NO);
+    }
+    if (frame % 16 == 0)
+    {
+        scriptKey(keys, VK_F4, 0, NO, NO);
+    }
+    if (frame % 100 == 50)
+    {
+        scriptKey(keys, VK_F5, 0, NO, NO);
+    }
+    if (frame == 30)
+    {
+        scriptKey(keys, VK_F6, 0, NO, NO);
+    }
+    if (frame % 240 == 120)
+    {
+        scriptKey(keys, 'Z', 0, NO, YES);
+        scriptKey(keys, 'Y', 0, NO, YES);
+    }
+    if (frame % 8 == 7)
+    {
+        scriptKey(keys, 0, kSymbols[(frame / 8) % (sizeof(kSymbols) / sizeof(kSymbols[0]))], NO, NO);
+    }
+    else
+    {
+        scriptKey(keys, 0, (u8)kText[frame % strlen(kText)], NO, NO);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// Initialise the game with the options from the command line.
+void startGame()
+{
+    init();
+    if (gCoalesceSet) setCoalescePolicy(&gCoalesce);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// Run the scripted workload for a number of frames into an offscreen target and report timings.  If shotFileName is
+// given, the final frame is also rendered on the CPU, checked against the GPU and saved.  Returns the process exit
+// code.
+int runHeadless(int width, int height, int numFrames, const char* shotFileName)
+{
+    if (!headlessInit())
+    {
+        prn("Headless: no window-less OpenGL context is available on this platform");
+        return 1;
+    }
+
+    // The statistics are part of the report.
+    gShowStats = YES;
+
+    // Frames are timed and compared with the CPU rasterizer, so wait for the real font.
+    initOpenGL(width, height);
+    loaderFinish();
+    startGame();
+
+    RenderTarget target;
+    createRenderTarget(&target, width, height);
+
+    Array(KeyState) keys = 0;
+    f64 simTime = 0.0, presentTime = 0.0, drawTime = 0.0;
+    f64 minFrame = 0.0, maxFrame = 0.0;
+    u64 uploadBytes = 0;
+
+    TimePoint start = timeNow();
+    for (int frame = 0; frame < numFrames; ++frame)
+    {
+        arrayClear(keys);
+        scriptFrame(frame, &keys);
+
+        SimulateIn s;
+        s.dt = 1.0 / 60.0;
+        s.key = keys;
+        s.mouse = 0;
+        s.width = gImageWidth;
+        s.height = gImageHeight;
+        s.numFonts = NUM_FONTS;
+
+        TimePoint t0 = timeNow();
+        simulate(&s);
+        TimePoint t1 = timeNow();
+        uploadBytes += updatePresentation();
+        TimePoint t2 = timeNow();
+        glClearColor(0, 0, 0, 1);
+        glClear(GL_COLOR_BUFFER_BIT);
+        drawCells(gRenderer, gImageWidth, gImageHeight, width, height);
+        glFinish();
+        TimePoint t3 = timeNow();
+
+        f64 frameTime = timeToSecs(timePeriod(t0, t3));
+        simTime += timeToSecs(timePeriod(t0, t1));
+        presentTime += timeToSecs(timePeriod(t1, t2));
+        drawTime += timeToSecs(timePeriod(t2, t3));
+        if (frame == 0 || frameTime < minFrame) minFrame = frameTime;
+        if (frame == 0 || frameTime > maxFrame) maxFrame = frameTime;
+    }
+    f64 total = timeToSecs(timePeriod(start, timeNow()));
+
+    prn("Headless: %d frames of %dx%d cells (%dx%d pixels) in %.3fs", numFrames, gImageWidth, gImageHeight,
+        width, height, total);
+    prn("  frame:    avg %.3fms, min %.3fms, max %.3fms", total * 1000.0 / numFrames, minFrame * 1000.0,
+        maxFrame * 1000.0);
+    prn("  simulate: avg %.3fms", simTime * 1000.0 / numFrames);
+    prn("  present:  avg %.3fms (%.1f bytes uploaded per frame)", presentTime * 1000.0 / numFrames,
+        (f64)uploadBytes / numFrames);
+    prn("  draw:     avg %.3fms", drawTime * 1000.0 / numFrames);
+
+    int result = 0;
+    if (shotFileName)
+    {
+        int shotWidth = gImageWidth * gFontWidth;
+        int shotHeight = gImageHeight * gFontHeight;
+        u32* pixels = K_ALLOC(sizeof(u32) * shotWidth * shotHeight);
+
+        RasterIn rin;
+        rin.font = &gFonts[gFont];
+        rin.fonts = gFonts;
+        rin.numFonts = NUM_FONTS;
+        rin.cells = gCells;
+        rin.columns = gImageWidth;
+        rin.rows = gImageHeight;
+        rin.originX = gView.x;
+        rin.originY = gView.y;
+        rin.palette = gPalette;
+        rin.cursor = &gCursor;
+        rin.pixels = pixels;
+        rin.pitch = shotWidth;
+        rin.path = cpuBestPath();
+        rasterize(&rin);
+        int numDiffs = compareWithFramebuffer(pixels, shotWidth, shotHeight, height);
+        prn("  shot:     %d pixels differ from the GPU", numDiffs);
+        if (!writePpm(shotFileName, pixels, shotWidth, shotHeight))
+        {
+            prn("Headless: cannot write '%s'", shotFileName);
+            result = 1;
+        }
+
+        K_FREE(pixels, sizeof(u32) * shotWidth * shotHeight);
+    }
+
+    arrayDone(keys);
+    destroyRenderTarget(&target);
+    done();
+    doneOpenGL();
+    headlessDone();
+    return result;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 int kmain(int argc, char** argv)
 {
+    TimePoint startTime = timeNow();
     debugBreakOnAlloc(0);
     const int width = 800;
     const int height = 600;
     Array(KeyState) keys = 0;
     Array(MouseState) mouses = 0;
+    bool benchmark = NO;
+    bool headless = NO;
+    int headlessFrames = 600;
+    int headlessWidth = 1920;
+    int headlessHeight = 1080;
+    const char* shotFileName = 0;
+    bool idle = YES;
+    f64 frameCap = 0.0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-instanced") == 0) gRenderer = RENDERER_INSTANCED;
+        else if (strcmp(argv[i], "-bench") == 0) benchmark = YES;
+        else if (strcmp(argv[i], "-headless") == 0) headless = YES;
+        else if (strcmp(argv[i], "-frames") == 0 && i + 1 < argc) headlessFrames = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-shot") == 0 && i + 1 < argc) shotFileName = argv[++i];
+        else if (strcmp(argv[i], "-noidle") == 0) idle = NO;
+        else if (strcmp(argv[i], "-stats") == 0) gShowStats = YES;
+        else if (strcmp(argv[i], "-noshadercache") == 0) progCacheEnable(NO);
+        else if (strcmp(argv[i], "-data") == 0 && i + 1 < argc) assetsSetDir(argv[++i]);
+        else if (strcmp(argv[i], "-font") == 0 && i + 1 < argc)
+        {
+            int font = findFont(argv[++i]);
+            if (font >= 0) gWantedFont = font;
+            else prn("Unknown font: %s", argv[i]);
+        }
+        else if (strcmp(argv[i], "-glyphcache") == 0 && i + 1 < argc) gGlyphCacheGlyphs = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-coalesce") == 0 && i + 1 < argc)
+        {
+            if (sscanf(argv[++i], "%lf,%d", &gCoalesce.burstGap, &gCoalesce.maxRun) == 2) gCoalesceSet = YES;
+            else prn("Expected -coalesce GAP,MAX: %s", argv[i]);
+        }
+        else if (strcmp(argv[i], "-fps") == 0 && i + 1 < argc) frameCap = atof(argv[++i]);
+        else if (strcmp(argv[i], "-size") == 0 && i + 1 < argc)
+        {
+            sscanf(argv[++i], "%dx%d", &headlessWidth, &headlessHeight);
+        }
+    }
+
+    if (headless)
+    {
+        return runHeadless(headlessWidth, headlessHeight, K_MAX(headlessFrames, 1), shotFileName);
+    }
 
     Window mainWindow;
     windowInit(&mainWindow);
@@ -400,13 +1597,37 @@ int kmain(int argc, char** argv)
     windowApply(&mainWindow);
     initOpenGL(width, height);
 
-    init();
+    if (benchmark)
+    {
+        loaderFinish();
+        runKernelBenchmark();
+        runBenchmark();
+        doneOpenGL();
+        windowDone(&mainWindow);
+        return 0;
+    }
 
+    startGame();
+
+    if (assetsDir())
+    {
+        if (watchInit(assetsDir())) prn("Watching %s for changed shaders and fonts", assetsDir());
+        else prn("Can't watch %s for changes", assetsDir());
+    }
+
+    // When idling, the loop only presents when the game has something new to draw and sleeps until input arrives or
+    // the game's next timer is due.  A frame cap holds presents back to at most frameCap per second.
     WindowEvent ev;
     bool run = YES;
     TimePoint t = timeNow();
+    TimePoint loopStart = t;
+    TimePoint lastFrame = t;
+    f64 minFrameTime = frameCap > 0.0 ? 1.0 / frameCap : 0.0;
+    int numWakeups = 0;
+    int numFrames = 0;
     while (run)
     {
+        ++numWakeups;
         arrayClear(keys);
         arrayClear(mouses);
 
@@ -426,6 +1647,11 @@ int kmain(int argc, char** argv)
                 {
                     mainWindow.fullscreen = !mainWindow.fullscreen;
                 }
+                else if (ev.input.down && ev.input.key == VK_F3)
+                {
+                    // F3 and Shift+F3 cycle through the fonts.
+                    selectFont((gWantedFont + (ev.input.shift ? NUM_FONTS - 1 : 1)) % NUM_FONTS);
+                }
                 else
                 {
                     KeyState* k = arrayNew(keys);
@@ -442,7 +1668,10 @@ int kmain(int argc, char** argv)
                     KeyState* k = arrayNew(keys);
                     k->down = YES;
                     k->vkey = 0;
-                    k->ch = ev.ch;
+
+                    // kore reports a typed character as a single char.  Read it unsigned so that Latin-1 isn't
+                    // sign-extended; characters beyond U+00FF can't be typed until kore passes whole codepoints.
+                    k->ch = (u8)ev.ch;
                 }
                 break;
 
@@ -451,6 +1680,10 @@ int kmain(int argc, char** argv)
             }
         }
 
+        // Pick up changed files, and anything the loader thread has finished, such as the real font.
+        checkReload();
+        loaderPoll();
+
         TimePoint newTime = timeNow();
         f64 dt = timeToSecs(timePeriod(t, newTime));
         t = newTime;
@@ -461,9 +1694,22 @@ int kmain(int argc, char** argv)
         s.mouse = mouses;
         s.width = gImageWidth;
         s.height = gImageHeight;
+        s.numFonts = NUM_FONTS;
+        bool presented = NO;
         if (simulate(&s))
         {
-            runPresentation(&mainWindow);
+            if (!idle || gCellsInvalid || gRedraw || needsPresent())
+            {
+                gRedraw = NO;
+                lastFrame = timeNow();
+                runPresentation(&mainWindow);
+                presented = YES;
+                if (++numFrames == 1 && gShowStats)
+                {
+                    prn("First frame: %.3fms after start, %dx%d font",
+                        timeToSecs(timePeriod(startTime, timeNow())) * 1000.0, gFontWidth, gFontHeight);
+                }
+            }
         }
         else
         {
@@ -473,11 +1719,32 @@ int kmain(int argc, char** argv)
         }
 
         windowApply(&mainWindow);
+
+        if (run)
+        {
+            // Input that arrives while the frame cap holds us back is picked up on the next pass.
+            if (presented && minFrameTime > 0.0)
+            {
+                idleSleep(minFrameTime - timeToSecs(timePeriod(lastFrame, timeNow())));
+            }
+            if (idle)
+            {
+                // A negative time means no timer is due.
+                f64 gameTimeout = timeUntilUpdate();
+                f64 reloadTimeout = timeUntilReload();
+                idleWait((gameTimeout < 0.0 || (reloadTimeout >= 0.0 && reloadTimeout < gameTimeout)) ?
+                    reloadTimeout : gameTimeout);
+            }
+        }
     }
 
+    f64 runTime = timeToSecs(timePeriod(loopStart, timeNow()));
+    if (gShowStats) prn("Main loop: %d wakeups, %d frames presented in %.1fs", numWakeups, numFrames, runTime);
+
     arrayDone(keys);
     arrayDone(mouses);
 
+    watchDone();
     doneOpenGL();
     return 0;
 }
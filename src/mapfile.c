@@ -0,0 +1,90 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       mapfile.c
+//! @brief      Read-only memory mapped files.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <mapfile.h>
+
+#if defined(_WIN32)
+
+#include <windows.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// Windows
+//----------------------------------------------------------------------------------------------------------------------
+
+bool mapFileOpen(MappedFile* file, const char* fileName)
+{
+    memoryClear(file, sizeof(*file));
+
+    HANDLE handle = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+        NULL);
+    if (handle == INVALID_HANDLE_VALUE) return NO;
+
+    LARGE_INTEGER size;
+    HANDLE mapping = NULL;
+    if (GetFileSizeEx(handle, &size) && size.QuadPart > 0)
+    {
+        mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    }
+    if (mapping)
+    {
+        file->bytes = (const u8*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        file->size = file->bytes ? size.QuadPart : 0;
+        CloseHandle(mapping);
+    }
+    CloseHandle(handle);
+
+    return file->bytes != 0;
+}
+
+void mapFileClose(MappedFile* file)
+{
+    if (file->bytes) UnmapViewOfFile(file->bytes);
+    memoryClear(file, sizeof(*file));
+}
+
+#else
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// POSIX
+//----------------------------------------------------------------------------------------------------------------------
+
+bool mapFileOpen(MappedFile* file, const char* fileName)
+{
+    memoryClear(file, sizeof(*file));
+
+    int fd = open(fileName, O_RDONLY);
+    if (fd < 0) return NO;
+
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        void* bytes = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (bytes != MAP_FAILED)
+        {
+            file->bytes = (const u8*)bytes;
+            file->size = (i64)st.st_size;
+        }
+    }
+    close(fd);
+
+    return file->bytes != 0;
+}
+
+void mapFileClose(MappedFile* file)
+{
+    if (file->bytes) munmap((void*)file->bytes, (size_t)file->size);
+    memoryClear(file, sizeof(*file));
+}
+
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
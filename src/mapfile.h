@@ -0,0 +1,28 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       mapfile.h
+//! @brief      Read-only memory mapped files.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <game.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// The file's pages are shared with the OS file cache, so mapping a file costs no copy and no heap memory.  The file
+// handles are closed as soon as the view exists; only the view has to be released.
+//----------------------------------------------------------------------------------------------------------------------
+
+STRUCT_START(MappedFile)
+{
+    const u8*   bytes;
+    i64         size;
+}
+STRUCT_END(MappedFile);
+
+// Map a whole file.  Returns NO, with file cleared, if it can't be opened or is empty.
+bool mapFileOpen(MappedFile* file, const char* fileName);
+void mapFileClose(MappedFile* file);
+
+//----------------------------------------------------------------------------------------------------------------------
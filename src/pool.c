@@ -0,0 +1,80 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       pool.c
+//! @brief      Fixed-size object pools carved from large slabs.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <pool.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void poolInit(Pool* pool, int objectSize, int slabCount)
+{
+    memoryClear(pool, sizeof(Pool));
+
+    // Free objects store the free list link in their first word.
+    pool->objectSize = K_MAX(objectSize, (int)sizeof(void*));
+    pool->slabCount = K_MAX(slabCount, 1);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void poolDone(Pool* pool)
+{
+    for (int i = 0; i < pool->numSlabs; ++i)
+    {
+        K_FREE(pool->slabs[i], pool->objectSize * pool->slabCount);
+    }
+    K_FREE(pool->slabs, pool->maxSlabs * sizeof(void*));
+    poolInit(pool, pool->objectSize, pool->slabCount);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+internal void poolNewSlab(Pool* pool)
+{
+    if (pool->numSlabs == pool->maxSlabs)
+    {
+        int newMax = K_MAX(16, pool->maxSlabs * 2);
+        pool->slabs = K_REALLOC(pool->slabs, pool->maxSlabs * sizeof(void*), newMax * sizeof(void*));
+        pool->maxSlabs = newMax;
+    }
+
+    u8* slab = K_ALLOC(pool->objectSize * pool->slabCount);
+    pool->slabs[pool->numSlabs++] = slab;
+
+    // Thread the new objects onto the free list in address order.
+    for (int i = pool->slabCount - 1; i >= 0; --i)
+    {
+        void** object = (void **)(slab + i * pool->objectSize);
+        *object = pool->freeList;
+        pool->freeList = object;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void* poolAlloc(Pool* pool)
+{
+    if (!pool->freeList) poolNewSlab(pool);
+
+    void** object = (void **)pool->freeList;
+    pool->freeList = *object;
+    ++pool->numUsed;
+    return object;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void poolFree(Pool* pool, void* object)
+{
+    if (object)
+    {
+        *(void **)object = pool->freeList;
+        pool->freeList = object;
+        --pool->numUsed;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,36 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       pool.h
+//! @brief      Fixed-size object pools carved from large slabs.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <game.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// A pool hands out objects of a single size.  Objects are carved out of slabs of slabCount objects and freed objects go
+// onto a free list for reuse, so after warm-up allocation never touches the system allocator and, because every object
+// in a pool is the same size, memory cannot fragment.  Slabs are only returned to the system when the pool is destroyed.
+//----------------------------------------------------------------------------------------------------------------------
+
+STRUCT_START(Pool)
+{
+    int     objectSize;     // Size of each object in bytes
+    int     slabCount;      // Number of objects per slab
+    void**  slabs;          // Every slab allocated so far
+    int     numSlabs;
+    int     maxSlabs;
+    void*   freeList;       // Free objects, linked through their first word
+    int     numUsed;        // Number of objects handed out
+}
+STRUCT_END(Pool);
+
+void poolInit(Pool* pool, int objectSize, int slabCount);
+void poolDone(Pool* pool);
+
+void* poolAlloc(Pool* pool);
+void poolFree(Pool* pool, void* object);
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,213 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       progcache.c
+//! @brief      On-disk cache of linked shader program binaries.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <progcache.h>
+#include <mapfile.h>
+
+#include <kore/kgl.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#   include <windows.h>
+#else
+#   include <sys/stat.h>
+#endif
+
+#define PROG_CACHE_DIR_SIZE     1024
+
+internal bool gProgCacheEnabled = YES;
+internal bool gProgCacheReady = NO;
+internal char gProgCacheDir[PROG_CACHE_DIR_SIZE];
+
+//----------------------------------------------------------------------------------------------------------------------
+// Keys
+//----------------------------------------------------------------------------------------------------------------------
+
+#define FNV_OFFSET      0xcbf29ce484222325ull
+#define FNV_PRIME       0x100000001b3ull
+
+internal u64 hashBytes(u64 hash, const void* bytes, i64 size)
+{
+    const u8* p = (const u8*)bytes;
+    for (i64 i = 0; i < size; ++i)
+    {
+        hash = (hash ^ p[i]) * FNV_PRIME;
+    }
+    // Terminate each field so that moving bytes between neighbouring fields changes the key.
+    return (hash ^ 0xff) * FNV_PRIME;
+}
+
+internal u64 hashString(u64 hash, const char* str)
+{
+    return hashBytes(hash, str ? str : "", str ? (i64)strlen(str) : 0);
+}
+
+u64 progCacheKey(const char* vertexCode, i64 vertexSize, const char* pixelCode, i64 pixelSize)
+{
+    u64 hash = FNV_OFFSET;
+    hash = hashString(hash, (const char*)glGetString(GL_VENDOR));
+    hash = hashString(hash, (const char*)glGetString(GL_RENDERER));
+    hash = hashString(hash, (const char*)glGetString(GL_VERSION));
+    hash = hashBytes(hash, vertexCode, vertexSize);
+    hash = hashBytes(hash, pixelCode, pixelSize);
+    return hash;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Cache directory
+//----------------------------------------------------------------------------------------------------------------------
+
+internal bool makeDir(const char* path)
+{
+#if defined(_WIN32)
+    return CreateDirectoryA(path, NULL) || GetLastError() == ERROR_ALREADY_EXISTS;
+#else
+    struct stat st;
+    return mkdir(path, 0755) == 0 || (stat(path, &st) == 0 && S_ISDIR(st.st_mode));
+#endif
+}
+
+internal bool findCacheDir()
+{
+    const char* dir = getenv("ASCII_SHADER_CACHE");
+    if (dir && *dir)
+    {
+        snprintf(gProgCacheDir, sizeof(gProgCacheDir), "%s", dir);
+        return makeDir(gProgCacheDir);
+    }
+
+#if defined(_WIN32)
+    const char* base = getenv("LOCALAPPDATA");
+    if (!base || !*base) return NO;
+    snprintf(gProgCacheDir, sizeof(gProgCacheDir), "%s\\ascii", base);
+#else
+    const char* base = getenv("XDG_CACHE_HOME");
+    if (base && *base)
+    {
+        snprintf(gProgCacheDir, sizeof(gProgCacheDir), "%s/ascii", base);
+    }
+    else
+    {
+        base = getenv("HOME");
+        if (!base || !*base) return NO;
+        snprintf(gProgCacheDir, sizeof(gProgCacheDir), "%s/.cache", base);
+        if (!makeDir(gProgCacheDir)) return NO;
+        snprintf(gProgCacheDir, sizeof(gProgCacheDir), "%s/.cache/ascii", base);
+    }
+#endif
+
+    return makeDir(gProgCacheDir);
+}
+
+// Returns NO if the cache can't be used at all on this run.
+internal bool progCacheReady()
+{
+    if (!gProgCacheEnabled) return NO;
+    if (!gProgCacheReady)
+    {
+        GLint numFormats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+        if (numFormats <= 0 || !findCacheDir())
+        {
+            gProgCacheEnabled = NO;
+            return NO;
+        }
+        gProgCacheReady = YES;
+    }
+    return YES;
+}
+
+internal void cacheFileName(char* fileName, int size, u64 key)
+{
+    snprintf(fileName, size, "%s/%016llx.prog", gProgCacheDir, (unsigned long long)key);
+}
+
+void progCacheEnable(bool enable)
+{
+    gProgCacheEnabled = enable;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Loading and saving
+//----------------------------------------------------------------------------------------------------------------------
+
+u32 progCacheLoad(u64 key)
+{
+    if (!progCacheReady()) return 0;
+
+    char fileName[PROG_CACHE_DIR_SIZE + 32];
+    cacheFileName(fileName, sizeof(fileName), key);
+
+    MappedFile file;
+    if (!mapFileOpen(&file, fileName)) return 0;
+
+    GLuint program = 0;
+    const ProgCacheHeader* header = (const ProgCacheHeader*)file.bytes;
+    if (file.size >= (i64)sizeof(*header) &&
+        header->magic == PROG_CACHE_MAGIC &&
+        header->version == PROG_CACHE_VERSION &&
+        header->key == key &&
+        header->length == (u64)(file.size - (i64)sizeof(*header)))
+    {
+        program = glCreateProgram();
+        glProgramBinary(program, header->binaryFormat, file.bytes + sizeof(*header), header->length);
+
+        GLint status = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &status);
+        if (status != GL_TRUE)
+        {
+            // Usually a driver update that kept the same version string.  The caller will recompile and overwrite
+            // the file.
+            glDeleteProgram(program);
+            program = 0;
+        }
+    }
+
+    mapFileClose(&file);
+    return program;
+}
+
+void progCacheSave(u32 program, u64 key)
+{
+    if (!progCacheReady()) return;
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+
+    u8* binary = K_ALLOC(length);
+    GLenum format = 0;
+    GLsizei written = 0;
+    glGetProgramBinary(program, length, &written, &format, binary);
+
+    if (written > 0)
+    {
+        ProgCacheHeader header;
+        header.magic = PROG_CACHE_MAGIC;
+        header.version = PROG_CACHE_VERSION;
+        header.key = key;
+        header.binaryFormat = (u32)format;
+        header.length = (u32)written;
+
+        // A torn write leaves a file whose length doesn't match its header, which progCacheLoad treats as a miss.
+        char fileName[PROG_CACHE_DIR_SIZE + 32];
+        cacheFileName(fileName, sizeof(fileName), key);
+        FILE* f = fopen(fileName, "wb");
+        if (f)
+        {
+            bool ok = fwrite(&header, sizeof(header), 1, f) == 1 && fwrite(binary, 1, written, f) == (size_t)written;
+            if ((fclose(f) != 0) || !ok) remove(fileName);
+        }
+    }
+
+    K_FREE(binary, length);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
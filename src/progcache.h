@@ -0,0 +1,50 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       progcache.h
+//! @brief      On-disk cache of linked shader program binaries.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <game.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// Compiling and linking the shaders is most of the driver's work at startup.  Once a program has linked, its binary
+// is written to the cache directory under a key made from the driver's vendor, renderer and version strings and the
+// shader sources, so any driver update or shader edit misses the cache rather than loading a stale binary.
+//
+// The cache lives in $ASCII_SHADER_CACHE if set, otherwise %LOCALAPPDATA%\ascii on Windows and
+// $XDG_CACHE_HOME/ascii (or ~/.cache/ascii) elsewhere.
+//
+// A program binary is only a hint: the driver may still reject it, in which case progCacheLoad returns 0 and the
+// caller compiles from source as normal.
+//----------------------------------------------------------------------------------------------------------------------
+
+#define PROG_CACHE_MAGIC        0x47525041      // 'APRG'
+#define PROG_CACHE_VERSION      1
+
+STRUCT_START(ProgCacheHeader)
+{
+    u32         magic;
+    u32         version;
+    u64         key;
+    u32         binaryFormat;
+    u32         length;
+}
+STRUCT_END(ProgCacheHeader);
+
+// Enable or disable the cache for the rest of the run.  It is also disabled if the driver has no binary formats.
+void progCacheEnable(bool enable);
+
+// Build the key for a program from the current context's driver strings and its sources.  Needs a current context.
+u64 progCacheKey(const char* vertexCode, i64 vertexSize, const char* pixelCode, i64 pixelSize);
+
+// Create a program from the cached binary for key.  Returns 0 on a miss or if the driver rejects the binary.
+u32 progCacheLoad(u64 key);
+
+// Store a linked program's binary under key.  The program should have been linked with
+// GL_PROGRAM_BINARY_RETRIEVABLE_HINT set.
+void progCacheSave(u32 program, u64 key);
+
+//----------------------------------------------------------------------------------------------------------------------
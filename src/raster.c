@@ -0,0 +1,363 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       raster.c
+//! @brief      CPU reference rasterizer for cell grids.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <raster.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// Font
+//----------------------------------------------------------------------------------------------------------------------
+
+void rasterFontInit(RasterFont* font, const FontAtlas* atlas)
+{
+    font->width = K_MIN(atlas->glyphWidth, RASTER_MAX_GLYPH_WIDTH);
+    font->height = atlas->glyphHeight;
+    font->numGlyphs = atlas->numGlyphs;
+    font->masks = K_ALLOC(sizeof(u32) * font->numGlyphs * font->height);
+
+    // Atlas rows are already bit masks; widen them to 32 bits.
+    const u8* row = atlas->bits;
+    for (int i = 0; i < font->numGlyphs * font->height; ++i, row += atlas->rowBytes)
+    {
+        u32 bits = 0;
+        for (int b = 0; b < K_MIN(atlas->rowBytes, 4); ++b) bits |= (u32)row[b] << (b * 8);
+        font->masks[i] = bits;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void rasterFontDone(RasterFont* font)
+{
+    if (font->masks) K_FREE(font->masks, sizeof(u32) * font->numGlyphs * font->height);
+    memoryClear(font, sizeof(*font));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Synthesized glyphs
+//----------------------------------------------------------------------------------------------------------------------
+
+// Light pixels x0 <= x < x1 of rows y0 <= y < y1.
+internal void synthRect(u32* masks, int x0, int y0, int x1, int y1)
+{
+    u32 bits = (u32)(((u64)1 << x1) - ((u64)1 << x0));
+    for (int y = y0; y < y1; ++y) masks[y] |= bits;
+}
+
+// Edge of the n'th of d equal parts of size, rounded to the nearest pixel.
+internal int synthSplit(int size, int n, int d)
+{
+    return (size * n + d / 2) / d;
+}
+
+bool rasterSynthGlyph(u32 codepoint, int width, int height, u32* masks)
+{
+    // Quadrants of U+2596 to U+259F: bit 0 upper left, 1 upper right, 2 lower left, 3 lower right.
+    static const u8 kQuadrants[] = { 4, 8, 1, 13, 9, 7, 11, 2, 6, 14 };
+
+    width = K_MIN(width, RASTER_MAX_GLYPH_WIDTH);
+    int w2 = synthSplit(width, 1, 2);
+    int h2 = synthSplit(height, 1, 2);
+
+    if (codepoint >= 0x2800 && codepoint <= 0x28ff)
+    {
+        // Dots 1 to 8 are bits 0 to 7: dots 1-3 and 7 run down the left column, 4-6 and 8 down the right.  Each dot
+        // is half the size of its eighth of the cell, centred in it.
+        static const u8 kDotX[] = { 0, 0, 0, 1, 1, 1, 0, 1 };
+        static const u8 kDotY[] = { 0, 1, 2, 0, 1, 2, 3, 3 };
+        memoryClear(masks, height * sizeof(u32));
+        for (int dot = 0; dot < 8; ++dot)
+        {
+            if (!(codepoint & (1u << dot))) continue;
+            int x0 = synthSplit(width, kDotX[dot], 2);
+            int x1 = synthSplit(width, kDotX[dot] + 1, 2);
+            int y0 = synthSplit(height, kDotY[dot], 4);
+            int y1 = synthSplit(height, kDotY[dot] + 1, 4);
+            int w = K_MAX((x1 - x0) / 2, 1);
+            int h = K_MAX((y1 - y0) / 2, 1);
+            x0 += (x1 - x0 - w) / 2;
+            y0 += (y1 - y0 - h) / 2;
+            synthRect(masks, x0, y0, x0 + w, y0 + h);
+        }
+        return YES;
+    }
+
+    if (codepoint >= 0x2581 && codepoint <= 0x2587)
+    {
+        // Lower one eighth to lower seven eighths.
+        memoryClear(masks, height * sizeof(u32));
+        synthRect(masks, 0, height - synthSplit(height, (int)(codepoint - 0x2580), 8), width, height);
+        return YES;
+    }
+
+    if (codepoint >= 0x2589 && codepoint <= 0x258f && codepoint != 0x258c)
+    {
+        // Left seven eighths to left one eighth.  The left half is in code page 437.
+        memoryClear(masks, height * sizeof(u32));
+        synthRect(masks, 0, 0, synthSplit(width, (int)(0x2590 - codepoint), 8), height);
+        return YES;
+    }
+
+    if (codepoint == 0x2594 || codepoint == 0x2595)
+    {
+        memoryClear(masks, height * sizeof(u32));
+        if (codepoint == 0x2594) synthRect(masks, 0, 0, width, synthSplit(height, 1, 8));
+        else synthRect(masks, width - synthSplit(width, 1, 8), 0, width, height);
+        return YES;
+    }
+
+    if (codepoint >= 0x2596 && codepoint <= 0x259f)
+    {
+        u8 quads = kQuadrants[codepoint - 0x2596];
+        memoryClear(masks, height * sizeof(u32));
+        if (quads & 1) synthRect(masks, 0, 0, w2, h2);
+        if (quads & 2) synthRect(masks, w2, 0, width, h2);
+        if (quads & 4) synthRect(masks, 0, h2, w2, height);
+        if (quads & 8) synthRect(masks, w2, h2, width, height);
+        return YES;
+    }
+
+    return NO;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Kernels
+// Each call draws one pixel row of a row of cells.  The per-cell state is resolved once per row of cells so the
+// kernels only expand masks.
+//----------------------------------------------------------------------------------------------------------------------
+
+typedef struct
+{
+    const u32*  mask;       // Row masks for the cell's glyph, or the blank glyph
+    int         height;     // Rows in mask; the rows of the cell below them are blank
+    u32         fore;
+    u32         back;
+    u32         underline;  // Or'ed into the bottom row: 0 or ~0
+}
+RasterCell;
+
+typedef void (*RasterLineFunc)(u32* dst, const RasterCell* cells, int columns, int y, int bottom, int width);
+
+internal void rasterLineScalar(u32* dst, const RasterCell* cells, int columns, int y, int bottom, int width)
+{
+    for (int c = 0; c < columns; ++c, dst += width)
+    {
+        const RasterCell* cell = &cells[c];
+        u32 bits = (y < cell->height ? cell->mask[y] : 0) | (bottom ? cell->underline : 0);
+        for (int x = 0; x < width; ++x)
+        {
+            dst[x] = (bits >> x) & 1 ? cell->fore : cell->back;
+        }
+    }
+}
+
+#if CPU_X86
+
+//----------------------------------------------------------------------------------------------------------------------
+// SSE2: 4 pixels at a time.  The mask bits for the 4 pixels are broadcast, isolated with a per-lane bit and compared
+// to produce a lane mask, which selects between the fore and back colours.
+
+internal void rasterLineSse2(u32* dst, const RasterCell* cells, int columns, int y, int bottom, int width)
+{
+    const __m128i sel = _mm_setr_epi32(1, 2, 4, 8);
+
+    for (int c = 0; c < columns; ++c, dst += width)
+    {
+        const RasterCell* cell = &cells[c];
+        u32 bits = (y < cell->height ? cell->mask[y] : 0) | (bottom ? cell->underline : 0);
+        __m128i fore = _mm_set1_epi32((int)cell->fore);
+        __m128i back = _mm_set1_epi32((int)cell->back);
+        int x = 0;
+
+        for (; x + 4 <= width; x += 4)
+        {
+            __m128i m = _mm_and_si128(_mm_set1_epi32((int)(bits >> x)), sel);
+            m = _mm_cmpeq_epi32(m, sel);
+            _mm_storeu_si128((__m128i*)(dst + x), _mm_or_si128(_mm_and_si128(m, fore), _mm_andnot_si128(m, back)));
+        }
+        for (; x < width; ++x)
+        {
+            dst[x] = (bits >> x) & 1 ? cell->fore : cell->back;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// AVX2: 8 pixels at a time, with the tail handled 4 pixels at a time as in the SSE2 kernel.
+
+TARGET_AVX2 internal void rasterLineAvx2(u32* dst, const RasterCell* cells, int columns, int y, int bottom, int width)
+{
+    const __m256i sel8 = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+    const __m128i sel4 = _mm_setr_epi32(1, 2, 4, 8);
+
+    for (int c = 0; c < columns; ++c, dst += width)
+    {
+        const RasterCell* cell = &cells[c];
+        u32 bits = (y < cell->height ? cell->mask[y] : 0) | (bottom ? cell->underline : 0);
+        __m256i fore = _mm256_set1_epi32((int)cell->fore);
+        __m256i back = _mm256_set1_epi32((int)cell->back);
+        int x = 0;
+
+        for (; x + 8 <= width; x += 8)
+        {
+            __m256i m = _mm256_and_si256(_mm256_set1_epi32((int)(bits >> x)), sel8);
+            m = _mm256_cmpeq_epi32(m, sel8);
+            _mm256_storeu_si256((__m256i*)(dst + x), _mm256_blendv_epi8(back, fore, m));
+        }
+        if (x + 4 <= width)
+        {
+            __m128i m = _mm_and_si128(_mm_set1_epi32((int)(bits >> x)), sel4);
+            m = _mm_cmpeq_epi32(m, sel4);
+            _mm_storeu_si128((__m128i*)(dst + x),
+                _mm_blendv_epi8(_mm256_castsi256_si128(back), _mm256_castsi256_si128(fore), m));
+            x += 4;
+        }
+        for (; x < width; ++x)
+        {
+            dst[x] = (bits >> x) & 1 ? cell->fore : cell->back;
+        }
+    }
+}
+
+#endif // CPU_X86
+
+//----------------------------------------------------------------------------------------------------------------------
+// Rasterizer
+//----------------------------------------------------------------------------------------------------------------------
+
+internal RasterLineFunc rasterLineFunc(SimdPath path)
+{
+#if CPU_X86
+    switch (path)
+    {
+    case SIMD_AVX2:     return cpuHasAvx2() ? &rasterLineAvx2 : &rasterLineSse2;
+    case SIMD_SSE2:     return &rasterLineSse2;
+    default:            break;
+    }
+#endif
+    return &rasterLineScalar;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// Fill the part of a cell covered by an underline or bar cursor at (cx, cy) on screen.
+internal void rasterCursor(const RasterIn* rin, int cx, int cy)
+{
+    const RasterFont* font = rin->font;
+    u32 colour = rin->palette[rin->cursor->colour] | 0xff000000;
+    int x0 = cx * font->width;
+    int y0 = cy * font->height;
+    int w = font->width;
+    int h = font->height;
+
+    if (rin->cursor->style == CURSOR_UNDERLINE)
+    {
+        y0 += h - K_MIN(CURSOR_THICKNESS, h);
+        h = K_MIN(CURSOR_THICKNESS, h);
+    }
+    else
+    {
+        w = K_MIN(CURSOR_THICKNESS, w);
+    }
+
+    for (int y = y0; y < y0 + h; ++y)
+    {
+        for (int x = x0; x < x0 + w; ++x) rin->pixels[y * rin->pitch + x] = colour;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void rasterize(const RasterIn* rin)
+{
+    static const u32 kBlank[RASTER_MAX_GLYPH_WIDTH] = { 0 };
+    const RasterFont* font = rin->font;
+    const u32* palette = rin->palette;
+    const Cursor* cursor = rin->cursor;
+    RasterLineFunc line = rasterLineFunc(rin->path);
+    int columns = rin->columns;
+    int rows = rin->rows;
+    RasterCell* row = K_ALLOC(sizeof(RasterCell) * columns);
+    int width = font->width;
+    int height = font->height;
+
+    // Room for a synthesized glyph in every column, as tall as the tallest font.
+    int synthRows = height;
+    for (int i = 0; i < rin->numFonts; ++i) synthRows = K_MAX(synthRows, rin->fonts[i].height);
+    u32* synth = K_ALLOC(sizeof(u32) * columns * synthRows);
+
+    // Find the cursor on screen.
+    CursorStyle cursorStyle = CURSOR_NONE;
+    int cursorX = cursor ? cursor->x - rin->originX : -1;
+    int cursorY = cursor ? cursor->y - rin->originY : -1;
+    if (cursorX >= 0 && cursorY >= 0 && cursorX < columns && cursorY < rows)
+    {
+        cursorStyle = cursor->style;
+    }
+
+    for (int r = 0; r < rows; ++r)
+    {
+        const Cell* cells = rin->cells + ((rin->originY + r) % rows) * columns;
+
+        // Resolve the cells the same way as ascii.fs: each cell's glyph comes from its own font if it has one, or is
+        // synthesized to fit it as the glyph cache does, codepoints with no glyph in their font are blank, a block
+        // cursor recolours its cell, inverse swaps the colours and underline lights the bottom row.  Alpha is forced
+        // to opaque.
+        for (int c = 0; c < columns; ++c)
+        {
+            const Cell* cell = &cells[(rin->originX + c) % columns];
+            u32 fore = palette[cell->fore] | 0xff000000;
+            u32 back = palette[cell->back] | 0xff000000;
+
+            if (cursorStyle == CURSOR_BLOCK && c == cursorX && r == cursorY)
+            {
+                fore = palette[cursor->textColour] | 0xff000000;
+                back = palette[cursor->colour] | 0xff000000;
+            }
+
+            const RasterFont* cellFont = font;
+            if (cell->font != CELL_FONT_GRID)
+            {
+                cellFont = cell->font <= rin->numFonts ? &rin->fonts[cell->font - 1] : 0;
+            }
+            int glyph = fontAtlasGlyph(cell->codepoint);
+            u32* synthMask = synth + c * synthRows;
+            if (cellFont && glyph >= 0 && glyph < cellFont->numGlyphs)
+            {
+                row[c].mask = cellFont->masks + glyph * cellFont->height;
+                row[c].height = cellFont->height;
+            }
+            else if (cellFont && rasterSynthGlyph(cell->codepoint, cellFont->width, cellFont->height, synthMask))
+            {
+                row[c].mask = synthMask;
+                row[c].height = cellFont->height;
+            }
+            else
+            {
+                row[c].mask = kBlank;
+                row[c].height = 0;
+            }
+            row[c].fore = (cell->attr & CELL_ATTR_INVERSE) ? back : fore;
+            row[c].back = (cell->attr & CELL_ATTR_INVERSE) ? fore : back;
+            row[c].underline = (cell->attr & CELL_ATTR_UNDERLINE) ? 0xffffffff : 0;
+        }
+
+        for (int y = 0; y < height; ++y)
+        {
+            line(rin->pixels + (r * height + y) * rin->pitch, row, columns, y, y == height - 1, width);
+        }
+    }
+
+    if (cursorStyle == CURSOR_UNDERLINE || cursorStyle == CURSOR_BAR)
+    {
+        rasterCursor(rin, cursorX, cursorY);
+    }
+
+    K_FREE(synth, sizeof(u32) * columns * synthRows);
+    K_FREE(row, sizeof(RasterCell) * columns);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,62 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       raster.h
+//! @brief      CPU reference rasterizer for cell grids.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cpu.h>
+#include <fontatlas.h>
+#include <game.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// Produces the same pixels as ascii.fs without a GPU, for screenshots on servers and as a reference to check the GPU
+// renderers against.  The font's 1-bit glyph rows are held as 32-bit masks and the kernels expand those masks into
+// fore/back colours.
+//----------------------------------------------------------------------------------------------------------------------
+
+// Glyph rows are stored as 32-bit masks, so glyphs can be at most this wide.
+#define RASTER_MAX_GLYPH_WIDTH  32
+
+STRUCT_START(RasterFont)
+{
+    int     width;          // Glyph size in pixels
+    int     height;
+    int     numGlyphs;
+    u32*    masks;          // numGlyphs * height row masks; bit x set = pixel x is lit
+}
+STRUCT_END(RasterFont);
+
+void rasterFontInit(RasterFont* font, const FontAtlas* atlas);
+void rasterFontDone(RasterFont* font);
+
+// Glyphs that code page 437 lacks but that are simple shapes are drawn to fit the font instead: the braille patterns
+// (U+2800 to U+28FF), the quadrants (U+2596 to U+259F), the eighth blocks (U+2581 to U+2587 and U+2589 to U+258F) and
+// the upper and right eighths (U+2594 and U+2595).  Writes height row masks and returns YES if the codepoint is one of
+// them.  The GPU's glyph cache holds the same masks.
+bool rasterSynthGlyph(u32 codepoint, int width, int height, u32* masks);
+
+STRUCT_START(RasterIn)
+{
+    const RasterFont*   font;           // Sets the cell size, and draws cells using CELL_FONT_GRID
+    const RasterFont*   fonts;          // Optional fonts 1 to numFonts for the other cells (see CELL_FONT_GRID)
+    int                 numFonts;
+    const Cell*         cells;          // columns * rows cells
+    int                 columns;
+    int                 rows;
+    int                 originX;        // Canvas coords of the top-left cell on screen.  The cells wrap around like
+    int                 originY;        // the presentation image (see Viewport).
+    const u32*          palette;        // PALETTE_SIZE colours
+    const Cursor*       cursor;         // Optional cursor in canvas coords
+    u32*                pixels;         // At least columns * font->width by rows * font->height pixels
+    int                 pitch;          // Distance between rows of pixels
+    SimdPath            path;
+}
+STRUCT_END(RasterIn);
+
+// Render the cells, and the cursor if it is given, into pixels (0xAABBGGRR, alpha is always 0xff).
+void rasterize(const RasterIn* rin);
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,227 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       watch.c
+//! @brief      Watching a directory for changed files.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <watch.h>
+
+#include <string.h>
+
+// Notifications are read into this buffer and handed out one at a time by watchPoll().
+#define WATCH_BUFFER_SIZE   4096
+
+#if defined(_WIN32)
+
+#include <windows.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// Windows
+//----------------------------------------------------------------------------------------------------------------------
+
+STRUCT_START(Watch)
+{
+    HANDLE      dir;
+    OVERLAPPED  overlapped;
+    DWORD       reading[WATCH_BUFFER_SIZE / sizeof(DWORD)];    // Filled by the outstanding read
+    DWORD       buffer[WATCH_BUFFER_SIZE / sizeof(DWORD)];     // FILE_NOTIFY_INFORMATION must be DWORD aligned
+    DWORD       size;           // Bytes of notifications in buffer
+    DWORD       offset;         // Offset of the next one to return
+    bool        pending;        // YES = a read is outstanding and may still write into reading
+}
+STRUCT_END(Watch);
+
+internal Watch gWatch = { .dir = INVALID_HANDLE_VALUE };
+
+internal bool watchRead()
+{
+    Watch* W = &gWatch;
+    W->pending = ReadDirectoryChangesW(W->dir, W->reading, sizeof(W->reading), FALSE,
+        FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE, NULL, &W->overlapped, NULL) != 0;
+    return W->pending;
+}
+
+bool watchInit(const char* dir)
+{
+    watchDone();
+
+    Watch* W = &gWatch;
+    W->dir = CreateFileA(dir, FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL,
+        OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, NULL);
+    if (W->dir == INVALID_HANDLE_VALUE) return NO;
+
+    W->overlapped.hEvent = CreateEventA(NULL, TRUE, FALSE, NULL);
+    if (!W->overlapped.hEvent || !watchRead())
+    {
+        watchDone();
+        return NO;
+    }
+    return YES;
+}
+
+void watchDone()
+{
+    Watch* W = &gWatch;
+    if (W->dir != INVALID_HANDLE_VALUE)
+    {
+        // The read must have finished before its buffer and event go away.
+        if (W->pending)
+        {
+            DWORD bytes = 0;
+            CancelIoEx(W->dir, &W->overlapped);
+            GetOverlappedResult(W->dir, &W->overlapped, &bytes, TRUE);
+        }
+        CloseHandle(W->dir);
+    }
+    if (W->overlapped.hEvent) CloseHandle(W->overlapped.hEvent);
+    memoryClear(W, sizeof(*W));
+    W->dir = INVALID_HANDLE_VALUE;
+}
+
+bool watchActive()
+{
+    return gWatch.dir != INVALID_HANDLE_VALUE;
+}
+
+bool watchPoll(char name[WATCH_NAME_SIZE])
+{
+    Watch* W = &gWatch;
+    if (W->dir == INVALID_HANDLE_VALUE) return NO;
+
+    for (;;)
+    {
+        if (W->offset == W->size)
+        {
+            // Nothing left in the buffer, so see if the outstanding read has finished and start the next one.
+            DWORD bytes = 0;
+            if (!GetOverlappedResult(W->dir, &W->overlapped, &bytes, FALSE))
+            {
+                if (GetLastError() != ERROR_IO_INCOMPLETE) W->pending = NO;
+                return NO;
+            }
+            W->pending = NO;
+            memcpy(W->buffer, W->reading, bytes);
+            W->size = bytes;
+            W->offset = 0;
+            watchRead();
+            if (bytes == 0) return NO;      // Overflowed: the changes are lost
+        }
+
+        const FILE_NOTIFY_INFORMATION* info = (const FILE_NOTIFY_INFORMATION*)((const u8*)W->buffer + W->offset);
+        W->offset = info->NextEntryOffset ? W->offset + info->NextEntryOffset : W->size;
+
+        if (info->Action == FILE_ACTION_REMOVED || info->Action == FILE_ACTION_RENAMED_OLD_NAME) continue;
+        int len = WideCharToMultiByte(CP_UTF8, 0, info->FileName, (int)(info->FileNameLength / sizeof(WCHAR)), name,
+            WATCH_NAME_SIZE - 1, NULL, NULL);
+        if (len <= 0) continue;
+        name[len] = 0;
+        return YES;
+    }
+}
+
+#elif defined(__linux__)
+
+#include <sys/inotify.h>
+#include <unistd.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// Linux
+//----------------------------------------------------------------------------------------------------------------------
+
+STRUCT_START(Watch)
+{
+    int         fd;
+    u64         buffer[WATCH_BUFFER_SIZE / sizeof(u64)];       // struct inotify_event must be aligned
+    int         size;
+    int         offset;
+}
+STRUCT_END(Watch);
+
+internal Watch gWatch = { .fd = -1 };
+
+bool watchInit(const char* dir)
+{
+    watchDone();
+
+    Watch* W = &gWatch;
+    W->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (W->fd < 0) return NO;
+
+    // IN_CLOSE_WRITE rather than IN_MODIFY, so a file isn't reported half written.
+    if (inotify_add_watch(W->fd, dir, IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
+    {
+        watchDone();
+        return NO;
+    }
+    return YES;
+}
+
+void watchDone()
+{
+    Watch* W = &gWatch;
+    if (W->fd >= 0) close(W->fd);
+    memoryClear(W, sizeof(*W));
+    W->fd = -1;
+}
+
+bool watchActive()
+{
+    return gWatch.fd >= 0;
+}
+
+bool watchPoll(char name[WATCH_NAME_SIZE])
+{
+    Watch* W = &gWatch;
+    if (W->fd < 0) return NO;
+
+    for (;;)
+    {
+        if (W->offset >= W->size)
+        {
+            ssize_t bytes = read(W->fd, W->buffer, sizeof(W->buffer));
+            if (bytes <= 0) return NO;
+            W->size = (int)bytes;
+            W->offset = 0;
+        }
+
+        const struct inotify_event* event = (const struct inotify_event*)((const u8*)W->buffer + W->offset);
+        W->offset += (int)(sizeof(struct inotify_event) + event->len);
+
+        if (event->len == 0 || (event->mask & IN_ISDIR)) continue;
+        strncpy(name, event->name, WATCH_NAME_SIZE - 1);
+        name[WATCH_NAME_SIZE - 1] = 0;
+        return YES;
+    }
+}
+
+#else
+
+//----------------------------------------------------------------------------------------------------------------------
+// Others
+//----------------------------------------------------------------------------------------------------------------------
+
+bool watchInit(const char* dir)
+{
+    (void)dir;
+    return NO;
+}
+
+void watchDone()
+{
+}
+
+bool watchActive()
+{
+    return NO;
+}
+
+bool watchPoll(char name[WATCH_NAME_SIZE])
+{
+    (void)name;
+    return NO;
+}
+
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
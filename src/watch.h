@@ -0,0 +1,34 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       watch.h
+//! @brief      Watching a directory for changed files.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <game.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// One directory (not its subdirectories) is watched at a time.  watchPoll() never blocks, so it is called from the
+// main loop.  Uses inotify on Linux and ReadDirectoryChangesW on Windows; elsewhere nothing is ever reported.
+//
+// A file can be reported several times while it is being written, and editors that save by writing a new file and
+// renaming it over the old one report the new name.  Callers should wait for the changes to settle before acting on
+// them.
+//----------------------------------------------------------------------------------------------------------------------
+
+#define WATCH_NAME_SIZE     256
+
+// Start watching a directory.  Returns NO if it can't be watched.
+bool watchInit(const char* dir);
+void watchDone();
+
+// YES if a directory is being watched.
+bool watchActive();
+
+// Get the name (without the directory) of the next file that has been written, created or renamed into the
+// directory since the last call.  Returns NO if there are none.
+bool watchPoll(char name[WATCH_NAME_SIZE]);
+
+//----------------------------------------------------------------------------------------------------------------------
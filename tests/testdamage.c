@@ -0,0 +1,119 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       testdamage.c
+//! @brief      Tests of damage rectangle merging.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <tests.h>
+
+#define GRID_SIZE   64
+
+//----------------------------------------------------------------------------------------------------------------------
+
+internal bool rectEquals(const DamageRect* r, int x, int y, int w, int h)
+{
+    return r->x == x && r->y == y && r->w == w && r->h == h;
+}
+
+internal bool covered(const Damage* damage, int x, int y)
+{
+    for (int i = 0; i < damage->count; ++i)
+    {
+        const DamageRect* r = &damage->rects[i];
+        if (x >= r->x && x < r->x + r->w && y >= r->y && y < r->y + r->h) return YES;
+    }
+    return NO;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// A run of typing grows one rectangle, and damage that doesn't touch it starts another.
+internal void testAdjacent()
+{
+    Damage damage;
+    damageClear(&damage);
+    for (int x = 0; x < 5; ++x) damageAdd(&damage, x, 3, 1, 1);
+    CHECK(damage.count == 1);
+    CHECK(rectEquals(&damage.rects[0], 0, 3, 5, 1));
+
+    damageAdd(&damage, 20, 20, 2, 2);
+    CHECK(damage.count == 2);
+    CHECK(rectEquals(&damage.rects[1], 20, 20, 2, 2));
+
+    // Overlapping damage grows the rectangle it overlaps.
+    damageAdd(&damage, 21, 21, 3, 1);
+    CHECK(damage.count == 2);
+    CHECK(rectEquals(&damage.rects[1], 20, 20, 4, 2));
+
+    // Empty rectangles are ignored.
+    damageAdd(&damage, 40, 40, 0, 5);
+    damageAdd(&damage, 40, 40, 5, -1);
+    CHECK(damage.count == 2);
+
+    damageClear(&damage);
+    CHECK(damage.count == 0);
+}
+
+// Once every rectangle is taken, new damage is merged into the one that grows the least.
+internal void testOverflow()
+{
+    Damage damage;
+    damageClear(&damage);
+    for (int i = 0; i < MAX_DAMAGE_RECTS; ++i) damageAdd(&damage, i * 4, 0, 1, 1);
+    CHECK(damage.count == MAX_DAMAGE_RECTS);
+
+    int last = (MAX_DAMAGE_RECTS - 1) * 4;
+    damageAdd(&damage, last + 2, 10, 1, 1);
+    CHECK(damage.count == MAX_DAMAGE_RECTS);
+    CHECK(rectEquals(&damage.rects[MAX_DAMAGE_RECTS - 1], last, 0, 3, 11));
+}
+
+// However the rectangles are merged, every damaged cell stays covered.
+internal void testCoverage()
+{
+    static bool damaged[GRID_SIZE][GRID_SIZE];
+
+    for (int round = 0; round < 50; ++round)
+    {
+        Damage damage;
+        damageClear(&damage);
+        memoryClear(damaged, sizeof(damaged));
+
+        int count = 1 + testRandom(40);
+        for (int i = 0; i < count; ++i)
+        {
+            int x = testRandom(GRID_SIZE);
+            int y = testRandom(GRID_SIZE);
+            int w = 1 + testRandom(K_MIN(8, GRID_SIZE - x));
+            int h = 1 + testRandom(K_MIN(8, GRID_SIZE - y));
+            damageAdd(&damage, x, y, w, h);
+            for (int yy = y; yy < y + h; ++yy)
+            {
+                for (int xx = x; xx < x + w; ++xx) damaged[yy][xx] = YES;
+            }
+        }
+
+        CHECK(damage.count >= 1 && damage.count <= MAX_DAMAGE_RECTS);
+        bool allCovered = YES;
+        for (int y = 0; y < GRID_SIZE; ++y)
+        {
+            for (int x = 0; x < GRID_SIZE; ++x)
+            {
+                if (damaged[y][x] && !covered(&damage, x, y)) allCovered = NO;
+            }
+        }
+        CHECK(allCovered);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void testDamage()
+{
+    testAdjacent();
+    testOverflow();
+    testCoverage();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
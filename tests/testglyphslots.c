@@ -0,0 +1,182 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       testglyphslots.c
+//! @brief      Tests of the glyph cache's least recently used slots.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <tests.h>
+#include <glyphslots.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// Slots are handed out from 1 up, slot 0 never, and 0 means there are none left.
+internal void testTake()
+{
+    GlyphSlots S;
+    glyphSlotsInit(&S, 4, 16);
+    glyphSlotsBeginUpdate(&S);
+
+    for (int i = 1; i < 4; ++i)
+    {
+        int slot = glyphSlotsTake(&S);
+        CHECK(slot == i);
+        glyphSlotsUse(&S, slot, 0x2580 + i, 0);
+        CHECK(S.head == slot);
+        CHECK(S.slots[slot].codepoint == 0x2580 + (u32)i);
+    }
+    CHECK(glyphSlotsTake(&S) == 0);
+    CHECK(S.tail == 1);
+
+    glyphSlotsDone(&S);
+
+    // Too few slots are clamped so that there is always one to hand out.
+    glyphSlotsInit(&S, 0, 16);
+    CHECK(S.numSlots == 2);
+    CHECK(glyphSlotsTake(&S) == 1);
+    CHECK(glyphSlotsTake(&S) == 0);
+    glyphSlotsDone(&S);
+}
+
+// The least recently used slot is evicted first, but never one used during this update.
+internal void testEvict()
+{
+    GlyphSlots S;
+    glyphSlotsInit(&S, 5, 16);
+    glyphSlotsBeginUpdate(&S);
+    for (int i = 1; i < 5; ++i) glyphSlotsUse(&S, glyphSlotsTake(&S), 0x2800 + i, 1);
+
+    // Everything was used during this update, so it is all on screen.
+    CHECK(glyphSlotsEvict(&S) == 0);
+
+    // In the next update, touching slots 1 and 3 leaves 2 as the least recently used, then 4.
+    glyphSlotsBeginUpdate(&S);
+    glyphSlotsTouch(&S, 1);
+    glyphSlotsTouch(&S, 3);
+    CHECK(S.head == 3);
+    CHECK(glyphSlotsUsedNow(&S, 1));
+    CHECK(!glyphSlotsUsedNow(&S, 2));
+
+    int slot = glyphSlotsEvict(&S);
+    CHECK(slot == 2);
+    CHECK(S.slots[slot].codepoint == 0x2802);
+    glyphSlotsUse(&S, slot, 0x28ff, 1);
+    CHECK(glyphSlotsEvict(&S) == 4);
+    glyphSlotsUse(&S, 4, 0x28fe, 1);
+
+    // Slots 1 to 4 are all on screen now.
+    CHECK(glyphSlotsEvict(&S) == 0);
+
+    glyphSlotsDone(&S);
+}
+
+// Growing doubles the slots up to the limit and keeps the ones in use.
+internal void testGrow()
+{
+    GlyphSlots S;
+    glyphSlotsInit(&S, 3, 10);
+    glyphSlotsBeginUpdate(&S);
+    glyphSlotsUse(&S, glyphSlotsTake(&S), 'x', 2);
+    glyphSlotsUse(&S, glyphSlotsTake(&S), 'y', 2);
+    CHECK(glyphSlotsTake(&S) == 0);
+
+    CHECK(glyphSlotsGrow(&S));
+    CHECK(S.numSlots == 6);
+    CHECK(glyphSlotsTake(&S) == 3);
+    CHECK(S.slots[1].codepoint == 'x');
+    CHECK(S.slots[2].codepoint == 'y');
+    CHECK(S.head == 2 && S.tail == 1);
+
+    CHECK(glyphSlotsGrow(&S));
+    CHECK(S.numSlots == 10);
+    CHECK(!glyphSlotsGrow(&S));
+    CHECK(S.numSlots == 10);
+
+    glyphSlotsDone(&S);
+}
+
+// Released slots are handed out again before new ones, and leave the LRU list.
+internal void testRelease()
+{
+    GlyphSlots S;
+    glyphSlotsInit(&S, 8, 8);
+    glyphSlotsBeginUpdate(&S);
+    for (int i = 1; i < 5; ++i) glyphSlotsUse(&S, glyphSlotsTake(&S), 'a' + i, 0);
+
+    glyphSlotsRelease(&S, 2);
+    glyphSlotsRelease(&S, 4);
+    CHECK(S.head == 3);
+    CHECK(S.slots[3].next == 1);
+    CHECK(S.tail == 1);
+
+    CHECK(glyphSlotsTake(&S) == 4);
+    CHECK(glyphSlotsTake(&S) == 2);
+    CHECK(glyphSlotsTake(&S) == 5);
+
+    // The only slots left on the list are evicted in order once they are off screen.
+    glyphSlotsBeginUpdate(&S);
+    CHECK(glyphSlotsEvict(&S) == 1);
+    CHECK(glyphSlotsEvict(&S) == 3);
+    CHECK(glyphSlotsEvict(&S) == 0);
+
+    glyphSlotsDone(&S);
+}
+
+// Random use against a plain array of last uses: an evicted slot is always the least recently used and never one used
+// during the update.
+internal void testRandomUse()
+{
+    enum { NUM_SLOTS = 17, NUM_UPDATES = 300 };
+    GlyphSlots S;
+    glyphSlotsInit(&S, NUM_SLOTS, NUM_SLOTS);
+    u32 lastUse[NUM_SLOTS] = { 0 };
+    u32 order[NUM_SLOTS] = { 0 };
+    u32 clock = 0;
+    bool ok = YES;
+
+    for (int u = 0; u < NUM_UPDATES; ++u)
+    {
+        glyphSlotsBeginUpdate(&S);
+        int uses = 1 + testRandom(NUM_SLOTS);
+        for (int i = 0; i < uses; ++i)
+        {
+            int slot = glyphSlotsTake(&S);
+            if (!slot && testRandom(2))
+            {
+                slot = 1 + testRandom(NUM_SLOTS - 1);
+                glyphSlotsTouch(&S, slot);
+            }
+            else
+            {
+                if (!slot) slot = glyphSlotsEvict(&S);
+                if (!slot) continue;
+
+                // Nothing has been used less recently, and it wasn't used during this update.
+                for (int s = 1; s < NUM_SLOTS; ++s)
+                {
+                    if (order[s] && s != slot && order[s] < order[slot]) ok = NO;
+                }
+                if (order[slot] && lastUse[slot] == S.update) ok = NO;
+                glyphSlotsUse(&S, slot, (u32)slot, 0);
+            }
+            lastUse[slot] = S.update;
+            order[slot] = ++clock;
+        }
+    }
+    CHECK(ok);
+
+    glyphSlotsDone(&S);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void testGlyphSlots()
+{
+    testTake();
+    testEvict();
+    testGrow();
+    testRelease();
+    testRandomUse();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
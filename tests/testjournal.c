@@ -0,0 +1,146 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       testjournal.c
+//! @brief      Tests of undo and redo through the journal.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <tests.h>
+#include <journal.h>
+
+#include <string.h>
+
+#define AREA_SIZE       48      // Commands write inside this square of the canvas
+#define NUM_COMMANDS    60      // Enough deltas to span several journal pages
+
+//----------------------------------------------------------------------------------------------------------------------
+
+internal Cell randomCell()
+{
+    Cell c;
+    c.codepoint = 'A' + (u32)testRandom(4);
+    c.fore = (u8)testRandom(4);
+    c.back = 0;
+    c.attr = 0;
+    c.font = CELL_FONT_GRID;
+    return c;
+}
+
+internal void snapshot(const Canvas* canvas, Cell* cells)
+{
+    canvasRead(canvas, 0, 0, AREA_SIZE, AREA_SIZE, cells, AREA_SIZE);
+}
+
+internal bool matches(const Canvas* canvas, const Cell* cells)
+{
+    Cell now[AREA_SIZE * AREA_SIZE];
+    snapshot(canvas, now);
+    return memcmp(now, cells, sizeof(now)) == 0;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// Undoing every command walks back through each earlier state of the canvas, and redoing them walks forward again.
+internal void testReplay()
+{
+    Cell clear = { ' ', 7, 0, 0, CELL_FONT_GRID };
+    Canvas canvas;
+    Journal journal;
+    canvasInit(&canvas, clear);
+    journalInit(&journal);
+
+    i64 stateSize = sizeof(Cell) * AREA_SIZE * AREA_SIZE;
+    Cell* states = K_ALLOC(stateSize * (NUM_COMMANDS + 1));
+    snapshot(&canvas, states);
+
+    for (int i = 0; i < NUM_COMMANDS; ++i)
+    {
+        // Each command is one or more rectangles, some of which overlap the same command's earlier ones.
+        journalBegin(&journal);
+        CHECK(journalIsOpen(&journal));
+        int parts = 1 + testRandom(3);
+        for (int p = 0; p < parts; ++p)
+        {
+            Cell cells[8 * 8];
+            int w = 1 + testRandom(8);
+            int h = 1 + testRandom(8);
+            for (int j = 0; j < w * h; ++j) cells[j] = randomCell();
+
+            // Undo skips commands that changed nothing, so make sure each one changes something.
+            if (p == 0) cells[0].codepoint = 0x100 + (u32)i;
+            journalApply(&journal, &canvas, testRandom(AREA_SIZE - w), testRandom(AREA_SIZE - h), w, h, cells);
+        }
+        snapshot(&canvas, states + (i64)(i + 1) * AREA_SIZE * AREA_SIZE);
+    }
+    CHECK(journal.numDeltas > JOURNAL_PAGE_SIZE);
+
+    bool undoOk = YES;
+    for (int i = NUM_COMMANDS - 1; i >= 0; --i)
+    {
+        journalUndo(&journal, &canvas);
+        if (!matches(&canvas, states + (i64)i * AREA_SIZE * AREA_SIZE)) undoOk = NO;
+    }
+    CHECK(undoOk);
+    CHECK(!journalIsOpen(&journal));
+
+    bool redoOk = YES;
+    for (int i = 1; i <= NUM_COMMANDS; ++i)
+    {
+        journalRedo(&journal, &canvas);
+        if (!matches(&canvas, states + (i64)i * AREA_SIZE * AREA_SIZE)) redoOk = NO;
+    }
+    CHECK(redoOk);
+    CHECK(journalIsOpen(&journal));
+    CHECK(journalRedo(&journal, &canvas) == 0);
+
+    K_FREE(states, stateSize * (NUM_COMMANDS + 1));
+    journalDone(&journal);
+    canvasDone(&canvas);
+}
+
+// A new command after an undo drops the commands that were undone.
+internal void testBranch()
+{
+    Cell clear = { ' ', 7, 0, 0, CELL_FONT_GRID };
+    Cell a = { 'a', 7, 0, 0, CELL_FONT_GRID };
+    Cell b = { 'b', 7, 0, 0, CELL_FONT_GRID };
+    Cell c = { 'c', 7, 0, 0, CELL_FONT_GRID };
+    Canvas canvas;
+    Journal journal;
+    canvasInit(&canvas, clear);
+    journalInit(&journal);
+
+    journalBegin(&journal);
+    journalApply(&journal, &canvas, 1, 1, 1, 1, &a);
+    journalBegin(&journal);
+    journalApply(&journal, &canvas, 1, 1, 1, 1, &b);
+
+    const Delta* d = journalUndo(&journal, &canvas);
+    CHECK(d && d->x == 1 && d->y == 1);
+    CHECK(canvasGet(&canvas, 1, 1).codepoint == 'a');
+
+    journalBegin(&journal);
+    journalApply(&journal, &canvas, 1, 1, 1, 1, &c);
+    CHECK(journal.numCommands == 2);
+    CHECK(journalRedo(&journal, &canvas) == 0);
+    CHECK(canvasGet(&canvas, 1, 1).codepoint == 'c');
+
+    journalUndo(&journal, &canvas);
+    CHECK(canvasGet(&canvas, 1, 1).codepoint == 'a');
+    journalUndo(&journal, &canvas);
+    CHECK(canvasGet(&canvas, 1, 1).codepoint == ' ');
+    CHECK(journalUndo(&journal, &canvas) == 0);
+
+    journalDone(&journal);
+    canvasDone(&canvas);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void testJournal()
+{
+    testReplay();
+    testBranch();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
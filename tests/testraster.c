@@ -0,0 +1,312 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       testraster.c
+//! @brief      Tests of the CPU rasterizer's kernels.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <tests.h>
+#include <raster.h>
+
+#include <string.h>
+
+#define TEST_COLUMNS    23
+#define TEST_ROWS       7
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// A font of random glyphs, with no bits set past its width.
+internal void makeFont(RasterFont* font, int width, int height)
+{
+    font->width = width;
+    font->height = height;
+    font->numGlyphs = 256;
+    font->masks = K_ALLOC(sizeof(u32) * font->numGlyphs * height);
+    u32 keep = width < 32 ? ((u32)1 << width) - 1 : 0xffffffff;
+    for (int i = 0; i < font->numGlyphs * height; ++i)
+    {
+        font->masks[i] = (((u32)testRandom(0x10000) << 16) | (u32)testRandom(0x10000)) & keep;
+    }
+}
+
+// Printable ASCII, code page 437 symbols, drawn block elements and braille, and codepoints with no glyph.
+internal Cell randomCell(int numFonts)
+{
+    static const u32 kOthers[] = { 0x2500, 0x2593, 0x263a, 0x2581, 0x258b, 0x259e, 0x28d5, 0x4e2d, 0x1f600 };
+    Cell c;
+    c.codepoint = testRandom(4) ? ' ' + (u32)testRandom(95) : kOthers[testRandom(sizeof(kOthers) / sizeof(kOthers[0]))];
+    c.fore = (u8)testRandom(PALETTE_SIZE);
+    c.back = (u8)testRandom(PALETTE_SIZE);
+    c.attr = (u8)testRandom(4);
+    c.font = (u8)testRandom(numFonts + 1);
+    return c;
+}
+
+// The pixel the shaders draw, worked out one pixel at a time.
+internal u32 referencePixel(const RasterIn* rin, int px, int py)
+{
+    const RasterFont* grid = rin->font;
+    int cx = px / grid->width;
+    int cy = py / grid->height;
+    int x = px % grid->width;
+    int y = py % grid->height;
+    const Cell* cell = &rin->cells[((rin->originY + cy) % rin->rows) * rin->columns + (rin->originX + cx) % rin->columns];
+    const RasterFont* font = cell->font == CELL_FONT_GRID ? grid : &rin->fonts[cell->font - 1];
+
+    u32 bits = 0;
+    u32 synth[64];
+    int glyph = fontAtlasGlyph(cell->codepoint);
+    if (glyph >= 0 && y < font->height)
+    {
+        bits = font->masks[glyph * font->height + y];
+    }
+    else if (glyph < 0 && rasterSynthGlyph(cell->codepoint, font->width, font->height, synth) && y < font->height)
+    {
+        bits = synth[y];
+    }
+    bool lit = ((bits >> x) & 1) || ((cell->attr & CELL_ATTR_UNDERLINE) && y == grid->height - 1);
+    bool inverse = (cell->attr & CELL_ATTR_INVERSE) != 0;
+    int fore = cell->fore;
+    int back = cell->back;
+
+    const Cursor* cursor = rin->cursor;
+    if (cursor && cursor->x - rin->originX == cx && cursor->y - rin->originY == cy)
+    {
+        switch (cursor->style)
+        {
+        case CURSOR_BLOCK:
+            fore = cursor->textColour;
+            back = cursor->colour;
+            break;
+        case CURSOR_UNDERLINE:
+            if (y >= grid->height - CURSOR_THICKNESS) return rin->palette[cursor->colour] | 0xff000000;
+            break;
+        case CURSOR_BAR:
+            if (x < CURSOR_THICKNESS) return rin->palette[cursor->colour] | 0xff000000;
+            break;
+        default:
+            break;
+        }
+    }
+    return rin->palette[lit != inverse ? fore : back] | 0xff000000;
+}
+
+// Returns YES if every path draws the reference pixels.
+internal bool matchesReference(const RasterIn* rin)
+{
+    int width = rin->columns * rin->font->width;
+    int height = rin->rows * rin->font->height;
+    i64 size = sizeof(u32) * width * height;
+    u32* pixels = K_ALLOC(size);
+    RasterIn in = *rin;
+    in.pixels = pixels;
+    in.pitch = width;
+
+    bool ok = YES;
+    for (int p = 0; p < SIMD_COUNT; ++p)
+    {
+        in.path = (SimdPath)p;
+        rasterize(&in);
+        for (int i = 0; i < width * height; ++i)
+        {
+            if (pixels[i] != referencePixel(&in, i % width, i / width)) ok = NO;
+        }
+    }
+
+    K_FREE(pixels, size);
+    return ok;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// Every SIMD path draws the same pixels as the scalar path, which draws the reference pixels, for glyph widths that
+// leave each kernel a different tail.
+internal void testKernels()
+{
+    static const int kSizes[][2] = { { 8, 16 }, { 10, 16 }, { 13, 13 }, { 16, 16 }, { 5, 9 }, { 32, 20 } };
+    enum { NUM_SIZES = sizeof(kSizes) / sizeof(kSizes[0]) };
+
+    RasterFont fonts[NUM_SIZES];
+    for (int i = 0; i < NUM_SIZES; ++i) makeFont(&fonts[i], kSizes[i][0], kSizes[i][1]);
+
+    u32 palette[PALETTE_SIZE];
+    for (int i = 0; i < PALETTE_SIZE; ++i) palette[i] = ((u32)testRandom(0x10000) << 8) ^ (u32)testRandom(0x10000);
+
+    Cell cells[TEST_COLUMNS * TEST_ROWS];
+    for (int i = 0; i < TEST_COLUMNS * TEST_ROWS; ++i) cells[i] = randomCell(NUM_SIZES);
+
+    for (int f = 0; f < NUM_SIZES; ++f)
+    {
+        RasterIn rin;
+        memoryClear(&rin, sizeof(rin));
+        rin.font = &fonts[f];
+        rin.fonts = fonts;
+        rin.numFonts = NUM_SIZES;
+        rin.cells = cells;
+        rin.columns = TEST_COLUMNS;
+        rin.rows = TEST_ROWS;
+        rin.originX = 5;
+        rin.originY = 3;
+        rin.palette = palette;
+        rin.pitch = TEST_COLUMNS * rin.font->width;
+
+        int width = rin.pitch;
+        int height = TEST_ROWS * rin.font->height;
+        i64 size = sizeof(u32) * width * height;
+        u32* pixels[SIMD_COUNT];
+        for (int p = 0; p < SIMD_COUNT; ++p)
+        {
+            pixels[p] = K_ALLOC(size);
+            rin.pixels = pixels[p];
+            rin.path = (SimdPath)p;
+            rasterize(&rin);
+        }
+
+        bool referenceOk = YES;
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                if (pixels[SIMD_SCALAR][y * width + x] != referencePixel(&rin, x, y)) referenceOk = NO;
+            }
+        }
+        CHECK(referenceOk);
+
+        // The AVX2 path falls back to SSE2 on CPUs without it, so it can always be compared.
+        CHECK(memcmp(pixels[SIMD_SSE2], pixels[SIMD_SCALAR], size) == 0);
+        CHECK(memcmp(pixels[SIMD_AVX2], pixels[SIMD_SCALAR], size) == 0);
+
+        for (int p = 0; p < SIMD_COUNT; ++p) K_FREE(pixels[p], size);
+    }
+
+    for (int i = 0; i < NUM_SIZES; ++i) rasterFontDone(&fonts[i]);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// Each cursor style is drawn over its cell, and only if the cursor is on screen.
+internal void testCursor()
+{
+    RasterFont font;
+    makeFont(&font, 9, 14);
+
+    u32 palette[PALETTE_SIZE];
+    for (int i = 0; i < PALETTE_SIZE; ++i) palette[i] = (u32)testRandom(0x1000000);
+
+    Cell cells[TEST_COLUMNS * TEST_ROWS];
+    for (int i = 0; i < TEST_COLUMNS * TEST_ROWS; ++i) cells[i] = randomCell(0);
+
+    RasterIn rin;
+    memoryClear(&rin, sizeof(rin));
+    rin.font = &font;
+    rin.cells = cells;
+    rin.columns = TEST_COLUMNS;
+    rin.rows = TEST_ROWS;
+    rin.originX = 4;
+    rin.originY = 2;
+    rin.palette = palette;
+
+    Cursor cursor;
+    cursor.colour = 7;
+    cursor.textColour = 200;
+    rin.cursor = &cursor;
+
+    static const int kPlaces[][2] = { { 4, 2 }, { 10, 5 }, { 26, 8 }, { 3, 2 }, { 27, 9 } };
+    for (int style = CURSOR_NONE; style <= CURSOR_BAR; ++style)
+    {
+        cursor.style = (CursorStyle)style;
+        for (int i = 0; i < (int)(sizeof(kPlaces) / sizeof(kPlaces[0])); ++i)
+        {
+            cursor.x = kPlaces[i][0];
+            cursor.y = kPlaces[i][1];
+            CHECK(matchesReference(&rin));
+        }
+    }
+
+    rasterFontDone(&font);
+}
+
+// Counts the lit pixels of a glyph.
+internal int countPixels(const u32* masks, int height)
+{
+    int n = 0;
+    for (int y = 0; y < height; ++y)
+    {
+        for (u32 bits = masks[y]; bits; bits &= bits - 1) ++n;
+    }
+    return n;
+}
+
+// Synthesized glyphs fill the right parts of the cell at any size, and nothing past its width.
+internal void testSynth()
+{
+    static const int kSizes[][2] = { { 8, 16 }, { 9, 14 }, { 5, 7 }, { 32, 32 } };
+    u32 masks[32];
+
+    for (int i = 0; i < (int)(sizeof(kSizes) / sizeof(kSizes[0])); ++i)
+    {
+        int w = kSizes[i][0];
+        int h = kSizes[i][1];
+        u32 full = w < 32 ? ((u32)1 << w) - 1 : 0xffffffff;
+
+        CHECK(!rasterSynthGlyph('A', w, h, masks));
+        CHECK(!rasterSynthGlyph(0x2588, w, h, masks));
+
+        // Lower one eighth fills whole bottom rows; upper one eighth the top ones.
+        CHECK(rasterSynthGlyph(0x2581, w, h, masks));
+        CHECK(masks[h - 1] == full && masks[0] == 0);
+        CHECK(countPixels(masks, h) % w == 0);
+        CHECK(rasterSynthGlyph(0x2594, w, h, masks));
+        CHECK(masks[0] == full && masks[h - 1] == 0);
+
+        // Left one eighth and right one eighth fill whole columns at either side.
+        CHECK(rasterSynthGlyph(0x258f, w, h, masks));
+        CHECK((masks[0] & 1) && !(masks[h - 1] >> (w - 1) & 1));
+        CHECK(rasterSynthGlyph(0x2595, w, h, masks));
+        CHECK(!(masks[0] & 1) && (masks[h - 1] >> (w - 1) & 1));
+
+        // The four quadrants of U+259B and U+2597 add up to the whole cell.
+        u32 other[32];
+        CHECK(rasterSynthGlyph(0x259b, w, h, masks));
+        CHECK(rasterSynthGlyph(0x2597, w, h, other));
+        bool tiled = YES;
+        for (int y = 0; y < h; ++y)
+        {
+            if ((masks[y] | other[y]) != full || (masks[y] & other[y])) tiled = NO;
+        }
+        CHECK(tiled);
+
+        // The blank braille pattern has no dots, and the full one has all eight with none overlapping.
+        CHECK(rasterSynthGlyph(0x2800, w, h, masks));
+        CHECK(countPixels(masks, h) == 0);
+        bool dots = YES;
+        int pixels = 0;
+        for (int d = 0; d < 8; ++d)
+        {
+            CHECK(rasterSynthGlyph(0x2800 + (1u << d), w, h, masks));
+            int n = countPixels(masks, h);
+            if (n == 0) dots = NO;
+            pixels += n;
+        }
+        CHECK(dots);
+        CHECK(rasterSynthGlyph(0x28ff, w, h, masks));
+        CHECK(countPixels(masks, h) == pixels);
+        bool inside = YES;
+        for (int y = 0; y < h; ++y)
+        {
+            if (masks[y] & ~full) inside = NO;
+        }
+        CHECK(inside);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void testRaster()
+{
+    testKernels();
+    testCursor();
+    testSynth();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
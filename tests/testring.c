@@ -0,0 +1,100 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       testring.c
+//! @brief      Tests of uploading damaged cells through a ring of reused slots.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <tests.h>
+#include <cellrow.h>
+
+#include <string.h>
+
+// The upload ring in main.c, without the GPU: each frame the damaged cells are copied into the next slot and only the
+// damaged rectangles of that slot reach the texture.  The slots are reused without being cleared, so what they hold
+// outside the damage is out of date and must never be uploaded.
+#define RING_SLOTS      3
+#define RING_WIDTH      37
+#define RING_HEIGHT     23
+#define RING_FRAMES     200
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// Only the damaged rectangles are copied.
+internal void testCopyRects()
+{
+    static Cell src[RING_WIDTH * RING_HEIGHT];
+    static Cell dst[RING_WIDTH * RING_HEIGHT];
+    Cell a = { 'a', 1, 0, 0, CELL_FONT_GRID };
+    Cell b = { 'b', 2, 0, 0, CELL_FONT_GRID };
+    for (int i = 0; i < RING_WIDTH * RING_HEIGHT; ++i)
+    {
+        src[i] = a;
+        dst[i] = b;
+    }
+
+    Damage damage;
+    damageClear(&damage);
+    damageAdd(&damage, 0, 0, 3, 2);
+    damageAdd(&damage, RING_WIDTH - 5, RING_HEIGHT - 1, 5, 1);
+    cellCopyRects(dst, src, RING_WIDTH, &damage);
+
+    int copied = 0;
+    for (int i = 0; i < RING_WIDTH * RING_HEIGHT; ++i) copied += dst[i].codepoint == 'a';
+    CHECK(copied == 3 * 2 + 5);
+    CHECK(dst[RING_WIDTH + 2].codepoint == 'a');
+    CHECK(dst[RING_WIDTH + 3].codepoint == 'b');
+    CHECK(dst[RING_WIDTH * RING_HEIGHT - 1].codepoint == 'a');
+}
+
+// Frame after frame of scattered damage, uploaded through reused slots, keeps the texture identical to the image.
+internal void testSlotReuse()
+{
+    static Cell image[RING_WIDTH * RING_HEIGHT];
+    static Cell texture[RING_WIDTH * RING_HEIGHT];
+    static Cell slots[RING_SLOTS][RING_WIDTH * RING_HEIGHT];
+    Cell clear = { ' ', 7, 0, 0, CELL_FONT_GRID };
+    for (int i = 0; i < RING_WIDTH * RING_HEIGHT; ++i)
+    {
+        image[i] = clear;
+        texture[i] = clear;
+    }
+    memset(slots, 0xcd, sizeof(slots));
+
+    bool inSync = YES;
+    for (int frame = 0; frame < RING_FRAMES; ++frame)
+    {
+        // Present: redraw some rectangles, sometimes more than fit in a Damage so that they merge.
+        Damage damage;
+        damageClear(&damage);
+        int count = 1 + testRandom(frame % 10 == 0 ? 30 : 4);
+        for (int i = 0; i < count; ++i)
+        {
+            int x = testRandom(RING_WIDTH);
+            int y = testRandom(RING_HEIGHT);
+            int w = 1 + testRandom(RING_WIDTH - x);
+            int h = 1 + testRandom(K_MIN(4, RING_HEIGHT - y));
+            Cell c = { 'A' + (u32)(frame % 26), (u8)testRandom(16), 0, 0, CELL_FONT_GRID };
+            for (int yy = y; yy < y + h; ++yy) cellFill(&image[yy * RING_WIDTH + x], c, w);
+            damageAdd(&damage, x, y, w, h);
+        }
+
+        // Upload: copy into this frame's slot, then from its damaged rectangles into the texture.
+        Cell* slot = slots[frame % RING_SLOTS];
+        cellCopyRects(slot, image, RING_WIDTH, &damage);
+        cellCopyRects(texture, slot, RING_WIDTH, &damage);
+
+        if (memcmp(texture, image, sizeof(image)) != 0) inSync = NO;
+    }
+    CHECK(inSync);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void testRing()
+{
+    testCopyRects();
+    testSlotReuse();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
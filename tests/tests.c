@@ -0,0 +1,59 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       tests.c
+//! @brief      Unit tests for the parts of the demo that don't need a GPU.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+// Usage: tests
+//
+// Runs every test and prints the ones that fail.  Returns 1 if any did.
+//----------------------------------------------------------------------------------------------------------------------
+
+#define K_IMPLEMENTATION
+#include <kore/kore.h>
+
+#include <tests.h>
+
+internal int gNumChecks = 0;
+internal int gNumFailures = 0;
+internal u32 gRandom = 12345;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void testCheck(bool ok, const char* expr, const char* file, int line)
+{
+    ++gNumChecks;
+    if (!ok)
+    {
+        ++gNumFailures;
+        prn("%s(%d): CHECK(%s) failed", file, line, expr);
+    }
+}
+
+int testRandom(int n)
+{
+    // xorshift32
+    gRandom ^= gRandom << 13;
+    gRandom ^= gRandom >> 17;
+    gRandom ^= gRandom << 5;
+    return (int)(gRandom % (u32)n);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+int kmain(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    testDamage();
+    testGlyphSlots();
+    testJournal();
+    testRaster();
+    testRing();
+
+    prn("%d checks, %d failed", gNumChecks, gNumFailures);
+    return gNumFailures ? 1 : 0;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
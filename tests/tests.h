@@ -0,0 +1,30 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       tests.h
+//! @brief      Unit tests for the parts of the demo that don't need a GPU.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <game.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+// Each test file has one entry point, called by kmain() in tests.c.  CHECK() reports a failed condition with its file
+// and line and carries on, so one run shows every failure.
+//----------------------------------------------------------------------------------------------------------------------
+
+#define CHECK(cond) testCheck((cond) ? YES : NO, #cond, __FILE__, __LINE__)
+
+void testCheck(bool ok, const char* expr, const char* file, int line);
+
+// Deterministic pseudo-random numbers in [0, n).
+int testRandom(int n);
+
+void testDamage();
+void testGlyphSlots();
+void testJournal();
+void testRaster();
+void testRing();
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,155 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       embed.c
+//! @brief      Generates a C source file that embeds data files as constant arrays.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+// Usage: embed <output.c> <files...>
+//
+// Each file becomes an entry in gEmbeddedAssets (see assets.h), named by its file name without the directory.  The
+// output is only rewritten if its contents change, so an unchanged build doesn't recompile it.
+//----------------------------------------------------------------------------------------------------------------------
+
+#define K_IMPLEMENTATION
+#include <kore/kore.h>
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+
+typedef struct
+{
+    char*   bytes;
+    i64     size;
+    i64     capacity;
+}
+Text;
+
+internal void textAdd(Text* text, const char* format, ...)
+{
+    va_list args;
+    for (;;)
+    {
+        i64 space = text->capacity - text->size;
+        va_start(args, format);
+        int len = vsnprintf(text->bytes + text->size, (size_t)space, format, args);
+        va_end(args);
+        if (len < space)
+        {
+            text->size += len;
+            return;
+        }
+
+        i64 capacity = K_MAX(text->capacity * 2, text->size + len + 4096);
+        text->bytes = K_REALLOC(text->bytes, text->capacity, capacity);
+        text->capacity = capacity;
+    }
+}
+
+internal const char* baseName(const char* path)
+{
+    const char* name = path;
+    for (const char* p = path; *p; ++p)
+    {
+        if (*p == '/' || *p == '\\') name = p + 1;
+    }
+    return name;
+}
+
+internal bool sameAsFile(const Text* text, const char* fileName)
+{
+    FILE* f = fopen(fileName, "rb");
+    if (!f) return NO;
+
+    bool same = YES;
+    char buffer[4096];
+    i64 offset = 0;
+    size_t len;
+    while (same && (len = fread(buffer, 1, sizeof(buffer), f)) > 0)
+    {
+        same = offset + (i64)len <= text->size && memcmp(buffer, text->bytes + offset, len) == 0;
+        offset += (i64)len;
+    }
+    fclose(f);
+    return same && offset == text->size;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+int kmain(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        prn("Usage: embed <output.c> <files...>");
+        return 1;
+    }
+
+    Text text = { 0 };
+    textAdd(&text,
+        "//------------------------------------------------------------------------------------------------------------"
+        "----------\r\n"
+        "// Generated by tools/embed.c from the files in data - do not edit.\r\n"
+        "//------------------------------------------------------------------------------------------------------------"
+        "----------\r\n"
+        "\r\n"
+        "#include <assets.h>\r\n");
+
+    i64 total = 0;
+    for (int i = 2; i < argc; ++i)
+    {
+        Data file = dataLoad(argv[i]);
+        if (!file.bytes)
+        {
+            prn("embed: cannot read '%s'", argv[i]);
+            return 1;
+        }
+
+        textAdd(&text, "\r\n// %s: %lld bytes\r\ninternal const u8 kAsset%d[] =\r\n{", baseName(argv[i]),
+            (long long)file.size, i - 2);
+        for (i64 b = 0; b < file.size; ++b)
+        {
+            textAdd(&text, "%s0x%02x,", (b % 16) ? " " : "\r\n    ", file.bytes[b]);
+        }
+        // Keep one zero byte past the end so text assets can also be used as C strings.
+        textAdd(&text, "%s0x00,\r\n};\r\n", (file.size % 16) ? " " : "\r\n    ");
+
+        total += (i64)file.size;
+        dataUnload(file);
+    }
+
+    textAdd(&text, "\r\nconst EmbeddedAsset gEmbeddedAssets[] =\r\n{\r\n");
+    for (int i = 2; i < argc; ++i)
+    {
+        textAdd(&text, "    { \"%s\", kAsset%d, sizeof(kAsset%d) - 1 },\r\n", baseName(argv[i]), i - 2, i - 2);
+    }
+    textAdd(&text, "};\r\n\r\nconst int gNumEmbeddedAssets = %d;\r\n", argc - 2);
+
+    int result = 0;
+    if (sameAsFile(&text, argv[1]))
+    {
+        prn("%s: up to date", argv[1]);
+    }
+    else
+    {
+        FILE* f = fopen(argv[1], "wb");
+        bool ok = f && fwrite(text.bytes, 1, (size_t)text.size, f) == (size_t)text.size;
+        if (f && fclose(f) != 0) ok = NO;
+        if (ok)
+        {
+            prn("%s: %d files, %lld bytes embedded", argv[1], argc - 2, (long long)total);
+        }
+        else
+        {
+            prn("embed: cannot write '%s'", argv[1]);
+            result = 1;
+        }
+    }
+
+    K_FREE(text.bytes, text.capacity);
+    return result;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
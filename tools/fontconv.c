@@ -0,0 +1,68 @@
+//----------------------------------------------------------------------------------------------------------------------
+//! @file       fontconv.c
+//! @brief      Converts PNG font atlases into precompiled .fnt files.
+//! @author     Matt Davies
+//! @copyright  Copyright (C)2018 Bit-7 Technology, all rights reserved.
+//----------------------------------------------------------------------------------------------------------------------
+// Usage: fontconv <input.png> <output.fnt>
+//
+// The input is an atlas of 16 x 16 glyphs.  See fontatlas.h for the output format.
+//----------------------------------------------------------------------------------------------------------------------
+
+#define K_IMPLEMENTATION
+#include <kore/kore.h>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#include <fontatlas.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+
+int kmain(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        prn("Usage: fontconv <input.png> <output.fnt>");
+        return 1;
+    }
+
+    Data file = dataLoad(argv[1]);
+    if (!file.bytes)
+    {
+        prn("fontconv: cannot read '%s'", argv[1]);
+        return 1;
+    }
+
+    int width, height, bpp;
+    u32* image = (u32*)stbi_load_from_memory(file.bytes, (int)file.size, &width, &height, &bpp, 4);
+    i64 pngSize = (i64)file.size;
+    dataUnload(file);
+    if (!image)
+    {
+        prn("fontconv: '%s' is not an image", argv[1]);
+        return 1;
+    }
+
+    FontAtlas atlas;
+    fontAtlasFromImage(&atlas, image, width, height);
+    stbi_image_free(image);
+
+    int result = 0;
+    if (fontAtlasSave(&atlas, argv[2]))
+    {
+        prn("%s: %dx%d pixels, %d glyphs, %lld bytes -> %s: %lld bytes", argv[1], atlas.glyphWidth, atlas.glyphHeight,
+            atlas.numGlyphs, (long long)pngSize, argv[2],
+            (long long)(sizeof(FontFileHeader) + fontAtlasBitsSize(&atlas)));
+    }
+    else
+    {
+        prn("fontconv: cannot write '%s'", argv[2]);
+        result = 1;
+    }
+
+    fontAtlasDone(&atlas);
+    return result;
+}
+
+//----------------------------------------------------------------------------------------------------------------------